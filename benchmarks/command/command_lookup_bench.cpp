@@ -0,0 +1,128 @@
+#include <gmredis/command/command.h>
+#include <gmredis/command/command_spec.h>
+#include "command/command_lookup.h"
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using gmredis::command::CommandName;
+using gmredis::command::CommandType;
+
+// The lookup get_command() used before the perfect hash, kept as the baseline.
+struct CaseInsensitiveHash {
+    std::size_t operator()(std::string_view sv) const {
+        std::size_t hash = 0;
+        for (char c : sv) {
+            hash = hash * 31 + static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return hash;
+    }
+};
+
+struct CaseInsensitiveEqual {
+    bool operator()(std::string_view a, std::string_view b) const {
+        return std::ranges::equal(a, b, [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+};
+
+using CommandMap = std::unordered_map<std::string_view, CommandType, CaseInsensitiveHash, CaseInsensitiveEqual>;
+
+// A command set the size of a real server's, to see how both lookups scale.
+constexpr std::array<CommandName, 48> kLargeTable{{
+    {"ping", CommandType::Ping}, {"get", CommandType::Get}, {"set", CommandType::Set},
+    {"del", CommandType::Get}, {"exists", CommandType::Get}, {"expire", CommandType::Get},
+    {"ttl", CommandType::Get}, {"incr", CommandType::Set}, {"incrby", CommandType::Set},
+    {"decr", CommandType::Set}, {"decrby", CommandType::Set}, {"mget", CommandType::Get},
+    {"mset", CommandType::Set}, {"append", CommandType::Set}, {"strlen", CommandType::Get},
+    {"getrange", CommandType::Get}, {"setrange", CommandType::Set}, {"getdel", CommandType::Get},
+    {"getex", CommandType::Get}, {"setnx", CommandType::Set}, {"setex", CommandType::Set},
+    {"hget", CommandType::Get}, {"hset", CommandType::Set}, {"hdel", CommandType::Set},
+    {"hgetall", CommandType::Get}, {"hincrby", CommandType::Set}, {"lpush", CommandType::Set},
+    {"rpush", CommandType::Set}, {"lpop", CommandType::Set}, {"rpop", CommandType::Set},
+    {"lrange", CommandType::Get}, {"llen", CommandType::Get}, {"sadd", CommandType::Set},
+    {"srem", CommandType::Set}, {"smembers", CommandType::Get}, {"sismember", CommandType::Get},
+    {"zadd", CommandType::Set}, {"zrem", CommandType::Set}, {"zrange", CommandType::Get},
+    {"zrangebyscore", CommandType::Get}, {"zremrangebyscore", CommandType::Set}, {"zscore", CommandType::Get},
+    {"info", CommandType::Ping}, {"command", CommandType::Ping}, {"config", CommandType::Ping},
+    {"client", CommandType::Ping}, {"slowlog", CommandType::Ping}, {"latency", CommandType::Ping},
+}};
+
+template <typename Table>
+CommandMap make_map(const Table& names) {
+    CommandMap map;
+    for (const auto& entry : names) {
+        map.emplace(entry.name, entry.type);
+    }
+    return map;
+}
+
+// Names as clients send them: mostly upper case, some lower, a few unknown.
+template <typename Table>
+std::vector<std::string> requests(const Table& names) {
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < 256; i++) {
+        std::string name(names[(i * 7) % names.size()].name);
+        if (i % 4 != 0) {
+            std::ranges::transform(name, name.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+        }
+        if (i % 16 == 0) {
+            name += "x";
+        }
+        result.push_back(std::move(name));
+    }
+    return result;
+}
+
+template <typename Find>
+void lookup_all(benchmark::State& state, const std::vector<std::string>& names, Find find) {
+    for (auto _ : state) {
+        for (const auto& name : names) {
+            benchmark::DoNotOptimize(find(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(names.size()));
+}
+
+void BM_CommandLookupMap(benchmark::State& state) {
+    const auto map = make_map(gmredis::command::command_specs);
+    lookup_all(state, requests(gmredis::command::command_specs), [&](std::string_view name) {
+        auto it = map.find(name);
+        return it != map.end() ? std::optional(it->second) : std::nullopt;
+    });
+}
+
+void BM_CommandLookupPerfectHash(benchmark::State& state) {
+    lookup_all(state, requests(gmredis::command::command_specs),
+               [](std::string_view name) { return gmredis::command::get_command(name); });
+}
+
+void BM_CommandLookupMapLarge(benchmark::State& state) {
+    const auto map = make_map(kLargeTable);
+    lookup_all(state, requests(kLargeTable), [&](std::string_view name) {
+        auto it = map.find(name);
+        return it != map.end() ? std::optional(it->second) : std::nullopt;
+    });
+}
+
+void BM_CommandLookupPerfectHashLarge(benchmark::State& state) {
+    static constexpr gmredis::command::detail::CommandLookup<kLargeTable.size()> lookup{kLargeTable};
+    lookup_all(state, requests(kLargeTable), [](std::string_view name) { return lookup.find(name); });
+}
+
+} // namespace
+
+BENCHMARK(BM_CommandLookupMap);
+BENCHMARK(BM_CommandLookupPerfectHash);
+BENCHMARK(BM_CommandLookupMapLarge);
+BENCHMARK(BM_CommandLookupPerfectHashLarge);
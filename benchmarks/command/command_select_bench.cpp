@@ -0,0 +1,71 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/command/get.h>
+#include <gmredis/command/ping.h>
+#include <gmredis/command/set.h>
+#include <gmredis/protocol/resp_view.h>
+#include "storage/kv_mem.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <unordered_map>
+
+namespace {
+
+using gmredis::command::Command;
+using gmredis::command::CommandType;
+
+// One selector shared by every benchmark thread, as the server shares it across io threads.
+gmredis::command::CommandSelector& shared_selector() {
+    static const auto selector = gmredis::command::make_command_selector(std::make_shared<gmredis::storage::KVMemoryStore>());
+    return *selector;
+}
+
+const gmredis::protocol::ArrayView& get_request() {
+    static const gmredis::protocol::ArrayView request{{
+        gmredis::protocol::BulkStringView{"GET"},
+        gmredis::protocol::BulkStringView{"user:1000"},
+    }};
+    return request;
+}
+
+// The registry lookup select() did before the dispatch table: a hashed contains() + at()
+// and a shared_ptr copy, whose reference count every thread increments and decrements.
+std::shared_ptr<Command> legacy_get_command(CommandType type) {
+    static const auto commands = [] {
+        auto store = std::make_shared<gmredis::storage::KVMemoryStore>();
+        std::unordered_map<CommandType, std::shared_ptr<Command>> map;
+        map.emplace(CommandType::Ping, std::make_shared<gmredis::command::PingCommand>());
+        map.emplace(CommandType::Get, std::make_shared<gmredis::command::GetCommand>(store));
+        map.emplace(CommandType::Set, std::make_shared<gmredis::command::SetCommand>(store));
+        return map;
+    }();
+    if (!commands.contains(type)) {
+        return nullptr;
+    }
+    return commands.at(type);
+}
+
+void BM_SelectSharedPtr(benchmark::State& state) {
+    const auto& request = get_request();
+    for (auto _ : state) {
+        auto const name = std::get<gmredis::protocol::BulkStringView>(request.values[0]).value;
+        auto command = legacy_get_command(*gmredis::command::get_command(name));
+        benchmark::DoNotOptimize(command.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SelectReference(benchmark::State& state) {
+    auto& selector = shared_selector();
+    const auto& request = get_request();
+    for (auto _ : state) {
+        auto command = selector.select(request);
+        benchmark::DoNotOptimize(&command->get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_SelectSharedPtr)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_SelectReference)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,56 @@
+#include <gmredis/command/get.h>
+#include <gmredis/protocol/reply_buffer.h>
+#include <gmredis/protocol/reply_sink.h>
+#include <gmredis/protocol/serialize.h>
+#include "storage/kv_mem.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+using gmredis::protocol::ArrayView;
+using gmredis::protocol::BulkStringView;
+
+// GET of one range(0)-byte value, up to the reply ready to be written. BM_GetCopied takes the
+// value out of the store and encodes a copy of it, as GET did before values were shared;
+// BM_GetReferenced streams the reply into a ReplyBuffer, which references the stored buffer.
+struct GetFixture {
+    explicit GetFixture(std::size_t size) : store(std::make_shared<gmredis::storage::KVMemoryStore>()), command(store) {
+        [[maybe_unused]] auto _ = store->put("blob", std::string(size, 'v'));
+    }
+
+    std::shared_ptr<gmredis::storage::KVMemoryStore> store;
+    gmredis::command::GetCommand command;
+    ArrayView request{.values = {BulkStringView{.value = "GET"}, BulkStringView{.value = "blob"}}};
+};
+
+void BM_GetCopied(benchmark::State& state) {
+    GetFixture fixture(static_cast<std::size_t>(state.range(0)));
+    std::string output;
+    for (auto _ : state) {
+        auto reply = fixture.command.execute(fixture.request);
+        gmredis::protocol::serialize_to(output, *reply);
+        benchmark::DoNotOptimize(output.data());
+        output.clear();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_GetReferenced(benchmark::State& state) {
+    GetFixture fixture(static_cast<std::size_t>(state.range(0)));
+    gmredis::protocol::ReplyBuffer output;
+    for (auto _ : state) {
+        gmredis::protocol::ReplySink sink(output);
+        benchmark::DoNotOptimize(fixture.command.executeInto(fixture.request, sink));
+        output.clear();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_GetCopied)->RangeMultiplier(4)->Range(4 << 10, 64 << 10);
+BENCHMARK(BM_GetReferenced)->RangeMultiplier(4)->Range(4 << 10, 64 << 10);
+
+}
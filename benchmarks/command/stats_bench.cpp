@@ -0,0 +1,31 @@
+#include <gmredis/command/latency_histogram.h>
+#include <gmredis/command/stats.h>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace {
+
+using gmredis::command::CommandType;
+
+// What BaseCommand::execute() adds per call once stats are enabled: counters and a histogram
+// bucket in the calling thread's shard.
+void BM_RecordCall(benchmark::State& state) {
+    gmredis::command::Stats stats;
+    std::uint64_t ns = 0;
+    for (auto _ : state) {
+        stats.record_call(CommandType::Get, ns++ & 0xFFFF, false);
+    }
+}
+BENCHMARK(BM_RecordCall)->Threads(1)->Threads(4);
+
+void BM_HistogramRecord(benchmark::State& state) {
+    gmredis::command::LatencyHistogram histogram;
+    std::uint64_t ns = 0;
+    for (auto _ : state) {
+        histogram.record(ns++ & 0xFFFFF);
+    }
+}
+BENCHMARK(BM_HistogramRecord);
+
+}
@@ -0,0 +1,78 @@
+#include <gmredis/protocol/incremental_parser.h>
+#include <gmredis/protocol/parse.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+
+using gmredis::protocol::IncrementalParser;
+using gmredis::protocol::ParseError;
+
+namespace {
+
+constexpr std::size_t kMtu = 1460;
+
+// A multi-bulk request with range(0) arguments of 16 bytes each (MSET/RPUSH-like).
+std::string many_arguments_frame(std::size_t arguments) {
+    std::string frame = "*" + std::to_string(arguments + 1) + "\r\n$5\r\nRPUSH\r\n";
+    for (std::size_t i = 0; i < arguments; i++) {
+        frame += "$16\r\n0123456789abcdef\r\n";
+    }
+    return frame;
+}
+
+// A SET carrying a single value of range(0) bytes.
+std::string large_value_frame(std::size_t value_size) {
+    return "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$" + std::to_string(value_size) + "\r\n" + std::string(value_size, 'v') +
+           "\r\n";
+}
+
+// Delivers frame in chunk-sized reads. After each read the incremental parser resumes,
+// while the baseline re-parses the frame from its first byte as RequestProcessor used to.
+template <bool Incremental>
+void feed(benchmark::State& state, const std::string& frame, std::size_t chunk) {
+    IncrementalParser parser;
+    for (auto _ : state) {
+        for (std::size_t received = std::min(chunk, frame.size());; received = std::min(received + chunk, frame.size())) {
+            std::string_view input(frame.data(), received);
+            bool done = false;
+            if constexpr (Incremental) {
+                auto result = parser.parse(input);
+                done = result.has_value() || result.error() != ParseError::Incomplete;
+                benchmark::DoNotOptimize(result);
+            } else {
+                auto result = gmredis::protocol::parse_view(input);
+                done = result.has_value() || result.error() != ParseError::Incomplete;
+                benchmark::DoNotOptimize(result);
+            }
+            if (done) {
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frame.size()));
+}
+
+void BM_IncrementalManyArguments(benchmark::State& state) {
+    feed<true>(state, many_arguments_frame(static_cast<std::size_t>(state.range(0))), static_cast<std::size_t>(state.range(1)));
+}
+
+void BM_ReparseManyArguments(benchmark::State& state) {
+    feed<false>(state, many_arguments_frame(static_cast<std::size_t>(state.range(0))), static_cast<std::size_t>(state.range(1)));
+}
+
+void BM_IncrementalLargeValue(benchmark::State& state) {
+    feed<true>(state, large_value_frame(static_cast<std::size_t>(state.range(0))), static_cast<std::size_t>(state.range(1)));
+}
+
+void BM_ReparseLargeValue(benchmark::State& state) {
+    feed<false>(state, large_value_frame(static_cast<std::size_t>(state.range(0))), static_cast<std::size_t>(state.range(1)));
+}
+
+}  // namespace
+
+// range(1) = bytes per read: 1 (byte-by-byte) or one Ethernet MTU worth of TCP payload
+BENCHMARK(BM_IncrementalManyArguments)->ArgsProduct({{16, 256, 1024}, {1, kMtu}})->ArgNames({"args", "chunk"});
+BENCHMARK(BM_ReparseManyArguments)->ArgsProduct({{16, 256, 1024}, {1, kMtu}})->ArgNames({"args", "chunk"});
+BENCHMARK(BM_IncrementalLargeValue)->ArgsProduct({{1024, 64 * 1024}, {1, kMtu}})->ArgNames({"bytes", "chunk"});
+BENCHMARK(BM_ReparseLargeValue)->ArgsProduct({{1024, 64 * 1024}, {1, kMtu}})->ArgNames({"bytes", "chunk"});
@@ -0,0 +1,156 @@
+#include <gmredis/protocol/incremental_parser.h>
+#include <gmredis/protocol/parse.h>
+#include "protocol/scan.h"
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::string bulk(std::string_view value) {
+    return "$" + std::to_string(value.size()) + "\r\n" + std::string(value) + "\r\n";
+}
+
+// Pipelined traffic of one request type, about 64 KiB worth.
+std::string traffic(std::string_view kind) {
+    std::string request;
+    if (kind == "get") {
+        request = "*2\r\n" + bulk("GET") + bulk("user:1000:profile");
+    } else if (kind == "set") {
+        request = "*3\r\n" + bulk("SET") + bulk("user:1000:profile") + bulk(std::string(64, 'v'));
+    } else {
+        request = "*21\r\n" + bulk("MSET");
+        for (int i = 0; i < 10; i++) {
+            request += bulk("key:" + std::to_string(i)) + bulk(std::string(16, 'v'));
+        }
+    }
+
+    std::string buffer;
+    while (buffer.size() < 64 * 1024) {
+        buffer += request;
+    }
+    return buffer;
+}
+
+constexpr std::string_view kTraffic[] = {"get", "set", "mset"};
+
+// Finds every CRLF in the buffer, as a parser that scans each line would.
+template <typename Find>
+void scan_all(benchmark::State& state, const std::string& buffer, Find find) {
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (auto at = find(buffer, 0); at != std::string_view::npos; at = find(buffer, at + 2)) {
+            count++;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+
+void BM_FindCrlfStringFind(benchmark::State& state) {
+    scan_all(state, traffic(kTraffic[state.range(0)]),
+             [](std::string_view input, std::size_t from) { return input.find("\r\n", from); });
+    state.SetLabel(std::string(kTraffic[state.range(0)]));
+}
+
+// Parses the whole pipelined buffer request by request, the way RequestProcessor does.
+void BM_ParseViewTraffic(benchmark::State& state) {
+    auto buffer = traffic(kTraffic[state.range(0)]);
+    for (auto _ : state) {
+        std::string_view input = buffer;
+        while (true) {
+            auto result = gmredis::protocol::parse_view(input);
+            if (!result.has_value()) {
+                break;
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+    state.SetLabel(std::string(kTraffic[state.range(0)]));
+}
+
+void BM_IncrementalParserTraffic(benchmark::State& state) {
+    auto buffer = traffic(kTraffic[state.range(0)]);
+    gmredis::protocol::IncrementalParser parser;
+    for (auto _ : state) {
+        std::string_view input = buffer;
+        while (true) {
+            auto result = parser.parse(input);
+            if (!result.has_value()) {
+                parser.reset();
+                break;
+            }
+            benchmark::DoNotOptimize(result);
+            input.remove_prefix(parser.frame_size());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+    state.SetLabel(std::string(kTraffic[state.range(0)]));
+}
+
+// Same as above, but reads the requests off the parser's tape as RequestProcessor does.
+void BM_TapeTraffic(benchmark::State& state) {
+    auto buffer = traffic(kTraffic[state.range(0)]);
+    gmredis::protocol::IncrementalParser parser;
+    for (auto _ : state) {
+        std::string_view input = buffer;
+        while (parser.parse_tape(input).has_value()) {
+            for (const auto& argument : parser.tape().array()) {
+                benchmark::DoNotOptimize(argument);
+            }
+            input.remove_prefix(parser.frame_size());
+        }
+        parser.reset();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+    state.SetLabel(std::string(kTraffic[state.range(0)]));
+}
+
+constexpr std::string_view kLengths[] = {"3", "17", "64", "1024", "65536", "4", "21", "5"};
+
+void BM_ParseDecimal(benchmark::State& state) {
+    for (auto _ : state) {
+        for (auto text : kLengths) {
+            std::size_t value = 0;
+            benchmark::DoNotOptimize(gmredis::protocol::parse_decimal(text, value));
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(std::size(kLengths)));
+}
+
+void BM_ParseDecimalFromChars(benchmark::State& state) {
+    for (auto _ : state) {
+        for (auto text : kLengths) {
+            std::size_t value = 0;
+            benchmark::DoNotOptimize(std::from_chars(text.data(), text.data() + text.size(), value));
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(std::size(kLengths)));
+}
+
+// One benchmark per scanner the CPU supports, e.g. BM_FindCrlf/avx2/0
+const bool scanners_registered = [] {
+    for (const auto& scanner : gmredis::protocol::crlf_scanners()) {
+        auto name = "BM_FindCrlf/" + std::string(scanner.name);
+        benchmark::RegisterBenchmark(name.c_str(), [find = scanner.find](benchmark::State& state) {
+            scan_all(state, traffic(kTraffic[state.range(0)]), find);
+            state.SetLabel(std::string(kTraffic[state.range(0)]));
+        })->DenseRange(0, 2);
+    }
+    return true;
+}();
+
+}  // namespace
+
+// range(0) selects the traffic: 0 = GET, 1 = SET with 64-byte values, 2 = MSET of 10 pairs
+BENCHMARK(BM_FindCrlfStringFind)->DenseRange(0, 2);
+BENCHMARK(BM_ParseViewTraffic)->DenseRange(0, 2);
+BENCHMARK(BM_IncrementalParserTraffic)->DenseRange(0, 2);
+BENCHMARK(BM_TapeTraffic)->DenseRange(0, 2);
+BENCHMARK(BM_ParseDecimal);
+BENCHMARK(BM_ParseDecimalFromChars);
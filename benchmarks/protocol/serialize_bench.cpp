@@ -0,0 +1,138 @@
+#include <gmredis/protocol/reply_sink.h>
+#include <gmredis/protocol/serialize.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+using gmredis::protocol::Array;
+using gmredis::protocol::BulkString;
+using gmredis::protocol::Integer;
+using gmredis::protocol::RespValue;
+using gmredis::protocol::SimpleString;
+
+// An MGET/LRANGE style reply: range(0) bulk strings of 16 bytes.
+RespValue array_reply(std::size_t size) {
+    Array array;
+    for (std::size_t i = 0; i < size; i++) {
+        auto value = "value:" + std::to_string(1000000000 + i);
+        array.values.emplace_back(BulkString{.value = value, .length = value.size()});
+    }
+    return array;
+}
+
+RespValue bulk_reply() {
+    std::string value(64, 'v');
+    return BulkString{.value = value, .length = value.size()};
+}
+
+// Serializes into a new string per reply and appends it, as replies used to be written.
+void serialize_strings(benchmark::State& state, const RespValue& reply) {
+    std::string output;
+    for (auto _ : state) {
+        output.clear();
+        output += gmredis::protocol::serialize(reply);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+
+// Appends into one output buffer that keeps its capacity, as RequestProcessor does.
+void serialize_to_buffer(benchmark::State& state, const RespValue& reply) {
+    std::string output;
+    for (auto _ : state) {
+        output.clear();
+        gmredis::protocol::serialize_to(output, reply);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+
+void BM_SerializeOk(benchmark::State& state) {
+    serialize_strings(state, SimpleString{.value = "OK"});
+}
+
+void BM_SerializeToOk(benchmark::State& state) {
+    serialize_to_buffer(state, SimpleString{.value = "OK"});
+}
+
+void BM_SerializeInteger(benchmark::State& state) {
+    serialize_strings(state, Integer{.value = 1234567});
+}
+
+void BM_SerializeToInteger(benchmark::State& state) {
+    serialize_to_buffer(state, Integer{.value = 1234567});
+}
+
+void BM_SerializeBulk(benchmark::State& state) {
+    serialize_strings(state, bulk_reply());
+}
+
+void BM_SerializeToBulk(benchmark::State& state) {
+    serialize_to_buffer(state, bulk_reply());
+}
+
+void BM_SerializeArray(benchmark::State& state) {
+    serialize_strings(state, array_reply(static_cast<std::size_t>(state.range(0))));
+}
+
+void BM_SerializeToArray(benchmark::State& state) {
+    serialize_to_buffer(state, array_reply(static_cast<std::size_t>(state.range(0))));
+}
+
+// The stored values an array reply is built from, e.g. the keys KEYS would return.
+std::vector<std::string> source_values(std::size_t size) {
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < size; i++) {
+        values.push_back("value:" + std::to_string(1000000000 + i));
+    }
+    return values;
+}
+
+// Builds the reply as a RespValue tree per call, then serializes it.
+void BM_MaterializeAndSerializeArray(benchmark::State& state) {
+    auto const values = source_values(static_cast<std::size_t>(state.range(0)));
+    std::string output;
+    for (auto _ : state) {
+        output.clear();
+        Array array;
+        array.values.reserve(values.size());
+        for (const auto& value : values) {
+            array.values.emplace_back(BulkString{.value = value, .length = value.size()});
+        }
+        gmredis::protocol::serialize_to(output, array);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+
+// Encodes the same reply element by element through a ReplySink, as streaming commands do.
+void BM_StreamArray(benchmark::State& state) {
+    auto const values = source_values(static_cast<std::size_t>(state.range(0)));
+    std::string output;
+    for (auto _ : state) {
+        output.clear();
+        gmredis::protocol::ReplySink sink(output);
+        sink.begin_array(values.size());
+        for (const auto& value : values) {
+            sink.bulk(value);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SerializeOk);
+BENCHMARK(BM_SerializeToOk);
+BENCHMARK(BM_SerializeInteger);
+BENCHMARK(BM_SerializeToInteger);
+BENCHMARK(BM_SerializeBulk);
+BENCHMARK(BM_SerializeToBulk);
+BENCHMARK(BM_SerializeArray)->Arg(10)->Arg(1000);
+BENCHMARK(BM_SerializeToArray)->Arg(10)->Arg(1000);
+BENCHMARK(BM_MaterializeAndSerializeArray)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_StreamArray)->Arg(10)->Arg(1000)->Arg(100000);
@@ -0,0 +1,83 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/server/server.h>
+#include <gmredis/storage/kv.h>
+
+#include <asio.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using gmredis::server::NetworkBackend;
+using gmredis::server::Server;
+using gmredis::server::ServerConfig;
+
+namespace {
+
+constexpr std::string_view kPing = "*1\r\n$4\r\nPING\r\n";
+constexpr std::string_view kPong = "+PONG\r\n";
+constexpr int kRoundTripsPerClient = 1000;
+
+// epoll vs io_uring with the same workload: range(0) = backend (0 epoll, 1 io_uring),
+// range(1) = client connections, range(2) = pipeline depth. Runs on two io threads.
+void BM_NetworkBackend(benchmark::State& state) {
+    auto backend = state.range(0) == 0 ? NetworkBackend::Epoll : NetworkBackend::IoUring;
+    auto client_count = static_cast<std::size_t>(state.range(1));
+    auto depth = static_cast<std::size_t>(state.range(2));
+
+    auto dispatcher = std::make_shared<gmredis::command::CommandDispatcher>(
+        gmredis::command::make_command_selector(gmredis::storage::make_store()));
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 2, .backend = backend},
+                  dispatcher);
+    if (!server.start()) {
+        state.SkipWithError("unable to start server");
+        return;
+    }
+    if (server.backend() != backend) {
+        state.SkipWithError("io_uring backend unavailable");
+        return;
+    }
+
+    asio::io_context client_context;
+    std::vector<asio::ip::tcp::socket> clients;
+    clients.reserve(client_count);
+    for (std::size_t i = 0; i < client_count; i++) {
+        auto& socket = clients.emplace_back(client_context);
+        socket.connect({asio::ip::make_address("127.0.0.1"), server.port()});
+        socket.set_option(asio::ip::tcp::no_delay(true));
+    }
+
+    std::string batch;
+    for (std::size_t i = 0; i < depth; i++) {
+        batch += kPing;
+    }
+
+    for (auto _ : state) {
+        std::vector<std::jthread> workers;
+        workers.reserve(client_count);
+        for (auto& socket : clients) {
+            workers.emplace_back([&socket, &batch, depth] {
+                std::string replies(depth * kPong.size(), '\0');
+                for (int i = 0; i < kRoundTripsPerClient; i++) {
+                    asio::write(socket, asio::buffer(batch));
+                    asio::read(socket, asio::buffer(replies));
+                }
+            });
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(client_count * depth) * kRoundTripsPerClient);
+    state.SetLabel(std::string(gmredis::server::to_string(server.backend())));
+
+    server.stop();
+    server.wait();
+}
+
+}  // namespace
+
+BENCHMARK(BM_NetworkBackend)
+    ->ArgsProduct({{0, 1}, {1, 16, 128}, {1, 32}})
+    ->ArgNames({"io_uring", "clients", "depth"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
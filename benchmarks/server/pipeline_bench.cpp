@@ -0,0 +1,66 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/server/server.h>
+#include <gmredis/storage/kv.h>
+
+#include <asio.hpp>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+
+using gmredis::server::Server;
+using gmredis::server::ServerConfig;
+
+namespace {
+
+constexpr std::string_view kPing = "*1\r\n$4\r\nPING\r\n";
+constexpr std::string_view kPong = "+PONG\r\n";
+constexpr std::string_view kSet = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n";
+constexpr std::string_view kOk = "+OK\r\n";
+
+// One client sending range(0) requests per round trip to a single-threaded server.
+// Depth 1 is the unpipelined baseline; items_per_second is commands per second.
+void run_pipeline(benchmark::State& state, std::string_view request, std::string_view reply) {
+    auto depth = static_cast<std::size_t>(state.range(0));
+
+    auto dispatcher = std::make_shared<gmredis::command::CommandDispatcher>(
+        gmredis::command::make_command_selector(gmredis::storage::make_store()));
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 1}, dispatcher);
+    if (!server.start()) {
+        state.SkipWithError("unable to start server");
+        return;
+    }
+
+    asio::io_context client_context;
+    asio::ip::tcp::socket socket(client_context);
+    socket.connect({asio::ip::make_address("127.0.0.1"), server.port()});
+    socket.set_option(asio::ip::tcp::no_delay(true));
+
+    std::string batch;
+    for (std::size_t i = 0; i < depth; i++) {
+        batch += request;
+    }
+    std::string replies(depth * reply.size(), '\0');
+
+    for (auto _ : state) {
+        asio::write(socket, asio::buffer(batch));
+        asio::read(socket, asio::buffer(replies));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(depth));
+
+    server.stop();
+    server.wait();
+}
+
+void BM_PipelinedPing(benchmark::State& state) {
+    run_pipeline(state, kPing, kPong);
+}
+
+void BM_PipelinedSet(benchmark::State& state) {
+    run_pipeline(state, kSet, kOk);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PipelinedPing)->ArgName("depth")->RangeMultiplier(4)->Range(1, 1024)->UseRealTime();
+BENCHMARK(BM_PipelinedSet)->ArgName("depth")->RangeMultiplier(4)->Range(1, 1024)->UseRealTime();
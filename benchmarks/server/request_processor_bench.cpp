@@ -0,0 +1,59 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/storage/kv.h>
+#include "server/request_processor.h"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+using gmredis::server::ReadBuffer;
+using gmredis::server::RequestProcessor;
+using gmredis::server::ServerConfig;
+
+namespace {
+
+constexpr std::string_view kPing = "*1\r\n$4\r\nPING\r\n";
+constexpr std::string_view kSet = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n";
+constexpr std::size_t kDepth = 256;
+
+// CPU cost per command of a pipelined batch, without the network: parse, dispatch, execute
+// and serialize the reply, as a session does for every batch it reads.
+void process_batch(benchmark::State& state, std::string_view request) {
+    auto dispatcher = std::make_shared<gmredis::command::CommandDispatcher>(
+        gmredis::command::make_command_selector(gmredis::storage::make_store()));
+    ServerConfig config;
+    config.max_batch_commands = kDepth;
+    RequestProcessor processor(dispatcher, config);
+
+    std::string batch;
+    for (std::size_t i = 0; i < kDepth; i++) {
+        batch += request;
+    }
+
+    ReadBuffer input;
+    gmredis::protocol::ReplyBuffer output;
+    for (auto _ : state) {
+        auto tail = input.prepare(batch.size());
+        std::memcpy(tail.data(), batch.data(), batch.size());
+        input.commit(batch.size());
+        processor.process(input, output);
+        benchmark::DoNotOptimize(output.bytes().data());
+        output.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kDepth));
+}
+
+void BM_ProcessPing(benchmark::State& state) {
+    process_batch(state, kPing);
+}
+
+void BM_ProcessSet(benchmark::State& state) {
+    process_batch(state, kSet);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ProcessPing);
+BENCHMARK(BM_ProcessSet);
@@ -0,0 +1,71 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/server/server.h>
+#include <gmredis/storage/kv.h>
+
+#include <asio.hpp>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using gmredis::server::Server;
+using gmredis::server::ServerConfig;
+
+namespace {
+
+constexpr std::string_view kRequest = "*1\r\n$4\r\nPING\r\n";
+constexpr std::string_view kReply = "+PONG\r\n";
+constexpr int kRoundTripsPerClient = 2000;
+
+// Throughput of request/reply round trips against an in-process server as the number of
+// io threads grows. range(0) = io threads, range(1) = concurrent client connections.
+void BM_ServerThroughputVsIoThreads(benchmark::State& state) {
+    auto io_threads = static_cast<std::size_t>(state.range(0));
+    auto client_count = static_cast<std::size_t>(state.range(1));
+
+    auto dispatcher = std::make_shared<gmredis::command::CommandDispatcher>(
+        gmredis::command::make_command_selector(gmredis::storage::make_store()));
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = io_threads}, dispatcher);
+    if (!server.start()) {
+        state.SkipWithError("unable to start server");
+        return;
+    }
+
+    asio::io_context client_context;
+    std::vector<asio::ip::tcp::socket> clients;
+    clients.reserve(client_count);
+    for (std::size_t i = 0; i < client_count; i++) {
+        auto& socket = clients.emplace_back(client_context);
+        socket.connect({asio::ip::make_address("127.0.0.1"), server.port()});
+        socket.set_option(asio::ip::tcp::no_delay(true));
+    }
+
+    for (auto _ : state) {
+        std::vector<std::jthread> workers;
+        workers.reserve(client_count);
+        for (auto& socket : clients) {
+            workers.emplace_back([&socket] {
+                std::array<char, kReply.size()> reply{};
+                for (int i = 0; i < kRoundTripsPerClient; i++) {
+                    asio::write(socket, asio::buffer(kRequest));
+                    asio::read(socket, asio::buffer(reply));
+                }
+            });
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(client_count) * kRoundTripsPerClient);
+    state.counters["io_threads"] = static_cast<double>(io_threads);
+
+    server.stop();
+    server.wait();
+}
+
+}  // namespace
+
+BENCHMARK(BM_ServerThroughputVsIoThreads)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {64}})
+    ->ArgNames({"io_threads", "clients"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,86 @@
+#include "storage/kv_mem.h"
+#include "storage/kv_sharded.h"
+#include "storage/kv_threading.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using gmredis::storage::KVMemoryStore;
+using gmredis::storage::KVStore;
+using gmredis::storage::ShardedKVStore;
+using gmredis::storage::ThreadSafeKVStore;
+
+constexpr std::size_t kKeys = 100000;
+
+// Shared by the threads of one benchmark run; thread 0 creates and destroys it, and the
+// framework starts and stops every thread's timed loop together.
+std::unique_ptr<KVStore> g_store;
+std::vector<std::string> g_keys;
+
+void set_up(std::unique_ptr<KVStore> store) {
+    g_keys.clear();
+    for (std::size_t i = 0; i < kKeys; i++) {
+        g_keys.push_back("key:" + std::to_string(i));
+        [[maybe_unused]] auto _ = store->put(g_keys.back(), std::string(32, 'v'));
+    }
+    g_store = std::move(store);
+}
+
+// Each thread runs GETs and SETs on random keys; range(0) is the percentage of writes.
+void run_mix(benchmark::State& state) {
+    auto const write_percent = static_cast<std::uint64_t>(state.range(0));
+    std::string const value(32, 'w');
+    // xorshift64, seeded per thread
+    std::uint64_t random = 0x9E3779B97F4A7C15ULL * (static_cast<std::uint64_t>(state.thread_index()) + 1);
+
+    for (auto _ : state) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        const auto& key = g_keys[random % kKeys];
+        if ((random >> 32) % 100 < write_percent) {
+            benchmark::DoNotOptimize(g_store->put(key, value));
+        } else {
+            benchmark::DoNotOptimize(g_store->get(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The previous store: one shared_mutex around a single map.
+void BM_GlobalLockStore(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        set_up(std::make_unique<ThreadSafeKVStore>(std::make_unique<KVMemoryStore>()));
+    }
+    run_mix(state);
+    if (state.thread_index() == 0) {
+        g_store.reset();
+    }
+}
+
+void BM_ShardedStore(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        set_up(std::make_unique<ShardedKVStore>(ShardedKVStore::default_shard_count,
+                                                [] { return std::make_unique<KVMemoryStore>(); }));
+    }
+    run_mix(state);
+    if (state.thread_index() == 0) {
+        g_store.reset();
+    }
+}
+
+// Write percentages: read only, read mostly, even, write heavy
+void contention_args(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgName("write%")->Arg(0)->Arg(10)->Arg(50)->Arg(90);
+    benchmark->Threads(1)->Threads(4)->Threads(16)->Threads(64)->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(BM_GlobalLockStore)->Apply(contention_args);
+BENCHMARK(BM_ShardedStore)->Apply(contention_args);
@@ -0,0 +1,54 @@
+#include "storage/kv_mem.h"
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+using gmredis::storage::KVMemoryStore;
+using Clock = std::chrono::steady_clock;
+
+// Keys stay within the SSO buffer so the allocator mostly sees the table's own nodes.
+std::string key_of(std::uint64_t i) {
+    return "k:" + std::to_string(i);
+}
+
+// Times every insert of range(0) new keys and reports the slowest. A plain unordered_map
+// pays for each resize inside one insert; KVMemoryStore spreads it over the following writes.
+template <typename Insert>
+void measure_inserts(benchmark::State& state, Insert insert) {
+    auto const keys = static_cast<std::uint64_t>(state.range(0));
+    std::string const value = "value";
+    std::int64_t max_ns = 0;
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < keys; i++) {
+            auto key = key_of(i);
+            auto const start = Clock::now();
+            insert(key, value);
+            max_ns = std::max<std::int64_t>(max_ns, std::chrono::nanoseconds(Clock::now() - start).count());
+        }
+    }
+    state.counters["max_op_us"] = static_cast<double>(max_ns) / 1000.0;
+    state.counters["ops"] = static_cast<double>(keys);
+}
+
+void BM_UnorderedMapInsertMaxLatency(benchmark::State& state) {
+    std::unordered_map<std::string, std::string> map;
+    measure_inserts(state, [&map](const std::string& key, const std::string& value) { map[key] = value; });
+}
+
+void BM_KVMemoryStoreInsertMaxLatency(benchmark::State& state) {
+    KVMemoryStore store;
+    measure_inserts(state, [&store](const std::string& key, const std::string& value) {
+        benchmark::DoNotOptimize(store.put(key, value));
+    });
+}
+
+BENCHMARK(BM_UnorderedMapInsertMaxLatency)->Arg(1'000'000)->Arg(10'000'000)->Arg(50'000'000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KVMemoryStoreInsertMaxLatency)->Arg(1'000'000)->Arg(10'000'000)->Arg(50'000'000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+}
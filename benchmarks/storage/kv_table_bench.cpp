@@ -0,0 +1,132 @@
+#include "storage/kv_flat.h"
+#include "storage/kv_mem.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+
+using gmredis::storage::KVFlatStore;
+using gmredis::storage::KVMemoryStore;
+using gmredis::storage::KVStore;
+
+// Bytes the heap has handed out, including large blocks it mapped directly, or 0 where
+// glibc's counters are not available.
+std::size_t heap_in_use() {
+#if defined(__GLIBC__)
+    auto const info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+std::string key_of(std::uint64_t i) {
+    return "key:" + std::to_string(i);
+}
+
+// Fills a store with range(0) keys of 32-byte values, then GETs random keys. Reports the heap
+// growth per key, which includes the keys and values themselves (past the SSO buffer).
+template <typename Store>
+void BM_RandomGet(benchmark::State& state) {
+    auto const keys = static_cast<std::uint64_t>(state.range(0));
+    auto const before = heap_in_use();
+    auto store = std::make_unique<Store>();
+    std::string const value(32, 'v');
+    for (std::uint64_t i = 0; i < keys; i++) {
+        [[maybe_unused]] auto _ = store->put(key_of(i), value);
+    }
+    auto const bytes = heap_in_use() - before;
+
+    // Keys are built up front so the loop times only the lookup
+    std::vector<std::string> probes;
+    std::uint64_t random = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 4096; i++) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        probes.push_back(key_of(random % keys));
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(store->get(probes[i++ & 4095]));
+    }
+    state.counters["bytes_per_key"] = static_cast<double>(bytes) / static_cast<double>(keys);
+}
+
+// Heap growth per entry for range(0) 16-byte keys with 32-byte values: small keys, where the
+// per-entry overhead rather than the payload decides the memory footprint. Nothing is timed.
+template <typename Store>
+void BM_BytesPerKey(benchmark::State& state) {
+    auto const keys = static_cast<std::uint64_t>(state.range(0));
+    std::string const value(32, 'v');
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        auto const before = heap_in_use();
+        auto store = std::make_unique<Store>();
+        for (std::uint64_t i = 0; i < keys; i++) {
+            [[maybe_unused]] auto _ = store->put(std::format("key:{:012}", i), value);
+        }
+        bytes = heap_in_use() - before;
+    }
+    state.counters["bytes_per_key"] = static_cast<double>(bytes) / static_cast<double>(keys);
+}
+
+// GET with a key sliced out of a request buffer, as commands see it: copied into a std::string
+// first (what the API used to require) or passed as the view. Keys are past the SSO size.
+void get_from_buffer(benchmark::State& state, bool copy_key) {
+    constexpr std::uint64_t keys = 100'000;
+    KVMemoryStore store;
+    std::string buffer;
+    std::vector<std::pair<std::size_t, std::size_t>> slices;
+    for (std::uint64_t i = 0; i < keys; i++) {
+        auto const key = "session:user:" + std::to_string(i) + ":preferences";
+        [[maybe_unused]] auto _ = store.put(key, "v");
+        slices.emplace_back(buffer.size(), key.size());
+        buffer += key;
+    }
+
+    std::uint64_t random = 0x9E3779B97F4A7C15ULL;
+    for (auto _ : state) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        auto const [offset, length] = slices[random % keys];
+        auto const key = std::string_view(buffer).substr(offset, length);
+        if (copy_key) {
+            benchmark::DoNotOptimize(store.get(std::string(key)));
+        } else {
+            benchmark::DoNotOptimize(store.get(key));
+        }
+    }
+}
+
+void BM_GetCopyingKey(benchmark::State& state) {
+    get_from_buffer(state, true);
+}
+
+void BM_GetByKeyView(benchmark::State& state) {
+    get_from_buffer(state, false);
+}
+
+BENCHMARK(BM_GetCopyingKey);
+BENCHMARK(BM_GetByKeyView);
+
+BENCHMARK(BM_RandomGet<KVMemoryStore>)->Arg(1'000'000)->Arg(10'000'000)->Arg(50'000'000)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_RandomGet<KVFlatStore>)->Arg(1'000'000)->Arg(10'000'000)->Arg(50'000'000)->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_BytesPerKey<KVMemoryStore>)->Arg(10'000'000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BytesPerKey<KVFlatStore>)->Arg(10'000'000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+}
@@ -11,13 +11,16 @@ class GmredisRecipe(ConanFile):
     settings = "os", "compiler", "build_type", "arch"
 
     # Sources
-    exports_sources = "CMakeLists.txt", "src/*", "lib/*", "tests/*", "cmake/*"
+    exports_sources = "CMakeLists.txt", "src/*", "lib/*", "tests/*", "benchmarks/*", "cmake/*"
 
     def requirements(self):
         self.requires("gtest/1.15.0")
         self.requires("catch2/3.7.1")
         self.requires("spdlog/1.15.0")
         self.requires("asio/1.31.0")
+        self.requires("benchmark/1.9.1")
+        if self.settings.os == "Linux":
+            self.requires("liburing/2.6")
 
     def generate(self):
         deps = CMakeDeps(self)
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "command.h"
+#include "slowlog.h"
+#include "stats.h"
+#include <chrono>
+#include <memory>
 
 namespace gmredis::command {
     /**
@@ -13,34 +17,43 @@ namespace gmredis::command {
      * The execution flow is:
      * 1. validate() -> preValidate() -> doValidate() -> postValidate()
      * 2. execute() -> preExecute() -> doExecute() -> postExecute()
+     * 3. executeInto() -> preExecute() -> doExecuteInto(), which by default is doExecute() ->
+     *    postExecute() followed by writing the result to the sink
      *
      * Derived classes must implement:
      * - doValidate(): Core validation logic
      * - doExecute(): Core execution logic
      *
      * Derived classes may optionally override:
+     * - doExecuteInto(): Stream the reply instead of materializing it (see materialize())
      * - preValidate(): Setup before validation (e.g., logging, metrics)
      * - postValidate(): Cleanup after validation
      * - preExecute(): Setup before execution (e.g., acquiring locks, logging)
      * - postExecute(): Cleanup after execution (e.g., releasing locks, metrics)
      *
+     * Once enableStats() has been called, every execution is timed and counted, and
+     * validation failures are counted as rejected calls (INFO commandstats). Once
+     * enableSlowLog() has been called, executions reaching the slow log threshold are recorded
+     * into it; faster ones cost the same two clock reads.
+     *
      * @example
      * ```cpp
      * class PingCommand : public BaseCommand {
      * protected:
-     *     std::optional<CommandError> doValidate(const protocol::Array& arg) override {
-     *         if (arg.values.size() > 1) {
+     *     std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override {
+     *         if (arg.size() > 1) {
      *             return CommandError(CommandErrorCode::WrongArgumentCount,
      *                               "PING takes 0 or 1 arguments");
      *         }
      *         return std::nullopt;
      *     }
      *
-     *     std::expected<protocol::RespValue, CommandError> doExecute(const protocol::Array& arg) override {
-     *         if (arg.values.empty()) {
-     *             return protocol::SimpleString("PONG");
+     *     std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override {
+     *         if (arg.empty()) {
+     *             return protocol::shared::pong;
      *         }
-     *         return protocol::BulkString{.value = arg.values[0], .length=arg.values[0].length};
+     *         auto const message = std::get<protocol::BulkStringView>(arg[0]).value;
+     *         return protocol::BulkString{.value = std::string(message), .length = message.size()};
      *     }
      * };
      * ```
@@ -55,10 +68,10 @@ namespace gmredis::command {
          * This method orchestrates the validation flow by calling preValidate(), doValidate(),
          * and postValidate() in sequence. Cannot be overridden in derived classes.
          *
-         * @param arg The command arguments as a RESP Array
+         * @param arg The command arguments, viewing the request buffer
          * @return std::nullopt if validation succeeds, or a CommandError on failure
          */
-        std::optional<CommandError> validate(const protocol::Array& arg) final override;
+        std::optional<CommandError> validate(const protocol::ArrayRef& arg) final override;
 
         /**
          * @brief Final implementation of Command::execute() using the Template Method pattern.
@@ -66,10 +79,38 @@ namespace gmredis::command {
          * This method orchestrates the execution flow by calling preExecute(), doExecute(),
          * and postExecute() in sequence. Cannot be overridden in derived classes.
          *
-         * @param arg The command arguments as a RESP Array
+         * @param arg The command arguments, viewing the request buffer
          * @return Expected containing the result on success, or a CommandError on failure
          */
-        std::expected<protocol::RespValue, CommandError> execute(const protocol::Array& arg) final override;
+        std::expected<protocol::RespValue, CommandError> execute(const protocol::ArrayRef& arg) final override;
+
+        /**
+         * @brief Final implementation of Command::executeInto() using the Template Method pattern.
+         *
+         * Runs preExecute() and doExecuteInto(), timed and recorded like execute().
+         *
+         * @param arg The command arguments, viewing the request buffer
+         * @param sink Where the reply is written
+         * @return std::nullopt on success, or a CommandError on failure
+         */
+        std::optional<CommandError> executeInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) final override;
+
+        /**
+         * @brief Records calls, execution time and failures of this command into stats.
+         *
+         * Call before the command is shared between threads.
+         *
+         * @param type The type the command is registered under
+         * @param stats Where to record; may be shared by every command
+         */
+        void enableStats(CommandType type, std::shared_ptr<Stats> stats) noexcept;
+
+        /**
+         * @brief Records executions that reach the threshold of slowlog into it.
+         *
+         * Call before the command is shared between threads.
+         */
+        void enableSlowLog(std::shared_ptr<SlowLog> slowlog) noexcept;
 
     protected:
         /**
@@ -78,7 +119,7 @@ namespace gmredis::command {
          * @param arg The command arguments to validate
          * @return std::nullopt if valid, or a CommandError describing the validation failure
          */
-        virtual std::optional<CommandError> doValidate(const protocol::Array& arg) = 0;
+        virtual std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) = 0;
 
         /**
          * @brief Performs the core execution logic (must be implemented by derived classes).
@@ -86,7 +127,29 @@ namespace gmredis::command {
          * @param arg The command arguments
          * @return Expected containing the command result or a CommandError on failure
          */
-        virtual std::expected<protocol::RespValue, CommandError> doExecute(const protocol::Array& arg) = 0;
+        virtual std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) = 0;
+
+        /**
+         * @brief Performs the core execution logic, writing the reply to sink (optional override).
+         *
+         * The default runs doExecute() and postExecute() and writes the result. Commands whose
+         * replies are large override this to encode elements as they produce them; an override
+         * should report errors before writing anything, and implement doExecute() with
+         * materialize().
+         *
+         * @param arg The command arguments
+         * @param sink Where the reply is written
+         * @return std::nullopt on success, or a CommandError describing the failure
+         */
+        virtual std::optional<CommandError> doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink);
+
+        /**
+         * @brief The reply doExecuteInto() streams, decoded into a RespValue.
+         *
+         * For commands that stream their replies, so execute() still works for callers that
+         * want a value; the network path never goes through it.
+         */
+        std::expected<protocol::RespValue, CommandError> materialize(const protocol::ArrayRef& arg);
 
         /**
          * @brief Hook called before doValidate() (optional override).
@@ -95,7 +158,7 @@ namespace gmredis::command {
          *
          * @param arg The command arguments
          */
-        virtual void preValidate([[maybe_unused]] const protocol::Array& arg) {};
+        virtual void preValidate([[maybe_unused]] const protocol::ArrayRef& arg) {};
 
         /**
          * @brief Hook called after doValidate() completes (optional override).
@@ -105,7 +168,7 @@ namespace gmredis::command {
          *
          * @param arg The command arguments
          */
-        virtual void postValidate([[maybe_unused]] const protocol::Array& arg) {};
+        virtual void postValidate([[maybe_unused]] const protocol::ArrayRef& arg) {};
 
         /**
          * @brief Hook called before doExecute() (optional override).
@@ -114,19 +177,28 @@ namespace gmredis::command {
          *
          * @param arg The command arguments
          */
-        virtual void preExecute([[maybe_unused]] const protocol::Array& arg) {};
+        virtual void preExecute([[maybe_unused]] const protocol::ArrayRef& arg) {};
 
         /**
          * @brief Hook called after doExecute() completes (optional override).
          *
-         * Called regardless of whether execution succeeded or failed.
+         * Called regardless of whether execution succeeded or failed, but only when the reply
+         * is produced by doExecute(); commands that stream through doExecuteInto() skip it.
          * Use this for cleanup operations like releasing locks or recording metrics.
          * The result can be inspected or even modified before being returned to the caller.
          *
          * @param arg The command arguments
          * @param result The execution result (can be inspected or modified)
          */
-        virtual void postExecute([[maybe_unused]] const protocol::Array& arg, [[maybe_unused]] std::expected<protocol::RespValue, CommandError>& result) {};
+        virtual void postExecute([[maybe_unused]] const protocol::ArrayRef& arg, [[maybe_unused]] std::expected<protocol::RespValue, CommandError>& result) {};
+
+    private:
+        /** Now when executions are timed, an unused value otherwise. */
+        [[nodiscard]] std::chrono::steady_clock::time_point startExecution() const noexcept;
+        void recordExecution(const protocol::ArrayRef& arg, std::chrono::steady_clock::time_point start, bool failed);
 
+        CommandType type_{};
+        std::shared_ptr<Stats> stats_;
+        std::shared_ptr<SlowLog> slowlog_;
    };
 }
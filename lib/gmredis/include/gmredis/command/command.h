@@ -1,11 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <optional>
-#include <algorithm>
 #include <expected>
+#include "gmredis/protocol/reply_sink.h"
 #include "gmredis/protocol/resp_v3.h"
+#include "gmredis/protocol/tape.h"
 
 
 namespace gmredis::command {
@@ -13,45 +15,28 @@ namespace gmredis::command {
     enum class CommandType {
         Ping,
         Get,
-        Set
+        Set,
+        Command,
+        Info,
+        Latency,
+        Slowlog
     };
 
-    struct CaseInsensitiveHash {
-        std::size_t operator()(std::string_view sv) const {
-            std::size_t hash = 0;
-            for (char c : sv) {
-                hash = hash * 31 + static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(c)));
-            }
-            return hash;
+    /** Number of CommandType values; they are dense from 0, so they can index a table. */
+    inline constexpr std::size_t command_type_count = static_cast<std::size_t>(CommandType::Slowlog) + 1;
 
-        }
+    struct CommandName {
+        std::string_view name;
+        CommandType type;
     };
 
-    struct CaseInsensitiveEqual {
-        bool operator()(std::string_view a, std::string_view b) const {
-            if (a.size() != b.size()) return false;
-            return std::equal(a.begin(), a.end(), b.begin(), b.end(),
-                             [](char a, char b) {
-                                 return std::tolower(static_cast<unsigned char>(a)) ==
-                                        std::tolower(static_cast<unsigned char>(b));
-                             });
-        }
-    };
-
-
-    inline auto make_command_table() {
-        std::unordered_map<std::string_view, CommandType, CaseInsensitiveHash, CaseInsensitiveEqual> command_map = {
-            {"ping", CommandType::Ping},
-            {"set", CommandType::Set},
-            {"get", CommandType::Get}
-        };
-
-        return command_map;
-    }
-
-    inline const auto command_table = make_command_table();
-
-    std::optional<CommandType> get_command(std::string_view command);
+    /**
+     * @brief The command named command, ignoring ASCII case.
+     *
+     * Names resolve through a perfect hash built at compile time from command_specs
+     * (command_spec.h); adding a spec is all it takes to make its name resolvable.
+     */
+    std::optional<CommandType> get_command(std::string_view command) noexcept;
 
     enum class CommandErrorCode {
         InvalidArgument,
@@ -97,11 +82,11 @@ namespace gmredis::command {
          * It should verify argument count, types, and any other preconditions
          * without modifying any state.
          *
-         * @param arg The command arguments as a RESP Array
+         * @param arg The command arguments, viewing the request buffer
          * @return std::nullopt if validation succeeds, or a CommandError describing
          *         the validation failure
          */
-        virtual std::optional<CommandError> validate(const protocol::Array&) = 0;
+        virtual std::optional<CommandError> validate(const protocol::ArrayRef&) = 0;
 
         /**
          * @brief Executes the command with the provided arguments.
@@ -109,10 +94,24 @@ namespace gmredis::command {
          * This method performs the actual command logic. It should only be called
          * after validate() has succeeded.
          *
-         * @param arg The command arguments as a RESP Array
+         * @param arg The command arguments, viewing the request buffer. Anything the command
+         *            keeps beyond this call (e.g. a stored value) must be copied.
          * @return Expected containing the command result as a RespValue on success,
          *         or a CommandError on failure
          */
-        virtual std::expected<protocol::RespValue, CommandError> execute(const protocol::Array&) = 0;
+        virtual std::expected<protocol::RespValue, CommandError> execute(const protocol::ArrayRef&) = 0;
+
+        /**
+         * @brief Executes the command, encoding the reply straight into sink.
+         *
+         * This is the path the dispatcher uses. The default writes the result of execute();
+         * commands with large replies override it to stream their elements instead.
+         *
+         * @param arg The command arguments, as for execute()
+         * @param sink Where the reply is written; left as is on failure, though callers should
+         *             rewind anything written before an error
+         * @return std::nullopt on success, or the CommandError to reply with instead
+         */
+        virtual std::optional<CommandError> executeInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink);
     };
 }
\ No newline at end of file
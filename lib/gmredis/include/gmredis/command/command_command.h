@@ -0,0 +1,38 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include <string>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis COMMAND introspection command.
+     *
+     * Reports the spec table (command_spec.h), which is what clients and cluster-aware
+     * drivers use to learn arities and key positions.
+     *
+     * **Command format:**
+     * - `COMMAND` → an Array describing every command
+     * - `COMMAND COUNT` → the number of commands, as an Integer
+     * - `COMMAND INFO [name ...]` → one description per name, Null for unknown names; every
+     *   command when no name is given
+     * - `COMMAND DOCS [name ...]` → an empty Array (no documentation is served)
+     *
+     * Each description has the Redis 7 layout: name, arity, flags, first key, last key, key
+     * step, then ACL categories, tips, key specifications and subcommands, which are empty.
+     *
+     * Replies are streamed into the ReplySink. The description of the whole table never
+     * changes, so it is encoded once at construction and written as an EncodedReply.
+     */
+    class CommandCommand : public BaseCommand {
+    public:
+        CommandCommand();
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+        std::optional<CommandError> doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) override;
+
+    private:
+        std::string all_commands_;
+    };
+}
@@ -2,6 +2,7 @@
 
 #include "gmredis/command/command.h"
 #include <expected>
+#include <functional>
 #include <optional>
 #include <memory>
 
@@ -24,13 +25,16 @@ namespace gmredis::command {
      *
      * The CommandRegistry provides a centralized location for registering and retrieving
      * Command implementations by their CommandType. It manages the lifetime of registered
-     * commands using shared_ptr for safe, shared ownership.
+     * commands using shared_ptr for safe, shared ownership, and hands out plain references so
+     * that looking a command up on the request path touches no reference counts.
      *
      * Key responsibilities:
      * - Register command implementations with their corresponding CommandType
      * - Prevent duplicate registrations for the same CommandType
      * - Retrieve command implementations by CommandType
      * - Manage command lifetime through shared ownership
+     * - Keep registered commands alive, so returned references stay valid, for as long as
+     *   the registry exists
      *
      * @note Implementations should be thread-safe if used in a multi-threaded context.
      *
@@ -48,7 +52,7 @@ namespace gmredis::command {
      * // Retrieve a command
      * auto getResult = registry.getCommand(CommandType::Ping);
      * if (getResult.has_value()) {
-     *     auto cmd = getResult.value();
+     *     Command& cmd = getResult.value();
      *     // Use the command...
      * } else {
      *     // Handle error: command not found
@@ -79,17 +83,16 @@ namespace gmredis::command {
              * @brief Retrieves a registered command implementation by CommandType.
              *
              * Looks up and returns the Command implementation associated with the given
-             * CommandType. Returns a shared_ptr to allow shared ownership of the command.
+             * CommandType. The registry keeps ownership; the reference is valid for as long
+             * as the registry is.
              *
              * @param type The CommandType to retrieve
-             * @return Expected containing a shared_ptr to the Command on success, or
+             * @return Expected containing a reference to the Command on success, or
              *         CommandRegistryError::CommandNotFound if no command is registered
              *         for this type
              *
              * @note This method is noexcept and will not throw exceptions
-             * @note The returned shared_ptr allows multiple callers to safely hold
-             *       references to the same command
              */
-            virtual std::expected<std::shared_ptr<Command>, CommandRegistryError> getCommand(CommandType) const noexcept = 0;
+            virtual std::expected<std::reference_wrapper<Command>, CommandRegistryError> getCommand(CommandType) const noexcept = 0;
     };
 }
\ No newline at end of file
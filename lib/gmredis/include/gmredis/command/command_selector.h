@@ -1,9 +1,9 @@
 #pragma once
 
 #include "gmredis/command/command.h"
-#include "gmredis/protocol/resp_v3.h"
+#include "gmredis/protocol/tape.h"
 #include <expected>
-#include <memory>
+#include <functional>
 
 namespace gmredis::command {
     /**
@@ -25,11 +25,12 @@ namespace gmredis::command {
          *            and subsequent elements are the command arguments.
          *
          * @return std::expected containing either:
-         *         - A shared_ptr to the selected Command instance on success, or
+         *         - A reference to the selected Command, owned by the selector and valid for
+         *           as long as it is, on success, or
          *         - A CommandError describing why the command could not be selected
          *           (e.g., unknown command, invalid format, parsing error)
          */
-        virtual std::expected<std::shared_ptr<Command>, CommandError> select(const protocol::Array& req) = 0;
+        virtual std::expected<std::reference_wrapper<Command>, CommandError> select(const protocol::ArrayRef& req) = 0;
 
         CommandSelector() = default;
 
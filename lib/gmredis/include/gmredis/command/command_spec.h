@@ -0,0 +1,108 @@
+#pragma once
+
+#include "gmredis/command/command.h"
+#include "gmredis/protocol/tape.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace gmredis::command {
+
+    enum class CommandFlag : std::uint32_t {
+        None = 0,
+        /** May modify the keyspace. */
+        Write = 1 << 0,
+        /** Only reads the keyspace. */
+        ReadOnly = 1 << 1,
+        /** Constant time, never blocks. */
+        Fast = 1 << 2,
+    };
+
+    constexpr CommandFlag operator|(CommandFlag a, CommandFlag b) noexcept {
+        return static_cast<CommandFlag>(static_cast<std::uint32_t>(a) | static_cast<std::uint32_t>(b));
+    }
+
+    constexpr bool has_flag(CommandFlag flags, CommandFlag flag) noexcept {
+        return (static_cast<std::uint32_t>(flags) & static_cast<std::uint32_t>(flag)) != 0;
+    }
+
+    /**
+     * @brief Static description of a command, in the shape Redis reports through COMMAND.
+     *
+     * Argument counts and key positions include the command name at index 0.
+     */
+    struct CommandSpec {
+        /** Lower-case command name. */
+        std::string_view name;
+        CommandType type;
+        /** Exact number of arguments when positive; at least -arity when negative. */
+        int arity;
+        CommandFlag flags;
+        /** Index of the first key, or 0 when the command takes no keys. */
+        int first_key;
+        /** Index of the last key; negative values count back from the end (-1 is the last argument). */
+        int last_key;
+        /** Distance between keys, e.g. 2 for MSET's key value pairs. */
+        int key_step;
+    };
+
+    /**
+     * @brief Every command the server knows.
+     *
+     * This table is the single description of the command set: get_command() resolves names
+     * through a perfect hash generated from it, the selector validates requests against it and
+     * COMMAND reports it.
+     */
+    inline constexpr std::array command_specs{
+        CommandSpec{"ping", CommandType::Ping, -1, CommandFlag::Fast, 0, 0, 0},
+        CommandSpec{"get", CommandType::Get, 2, CommandFlag::ReadOnly | CommandFlag::Fast, 1, 1, 1},
+        CommandSpec{"set", CommandType::Set, -3, CommandFlag::Write, 1, 1, 1},
+        CommandSpec{"command", CommandType::Command, -1, CommandFlag::None, 0, 0, 0},
+        CommandSpec{"info", CommandType::Info, -1, CommandFlag::None, 0, 0, 0},
+        CommandSpec{"latency", CommandType::Latency, -2, CommandFlag::None, 0, 0, 0},
+        CommandSpec{"slowlog", CommandType::Slowlog, -2, CommandFlag::None, 0, 0, 0},
+    };
+
+    /**
+     * @brief The spec of type.
+     */
+    const CommandSpec& command_spec(CommandType type) noexcept;
+
+    /**
+     * @brief Key positions of one request, resolved against its argument count.
+     *
+     * Keys are at first, first + step, ... up to and including last. A request without keys
+     * has first == 0 and step == 0.
+     */
+    struct KeyRange {
+        std::size_t first = 0;
+        std::size_t last = 0;
+        std::size_t step = 0;
+
+        [[nodiscard]] bool empty() const noexcept { return step == 0; }
+
+        bool operator==(const KeyRange&) const = default;
+    };
+
+    /**
+     * @brief Where the keys of a request with argc arguments are.
+     *
+     * @pre argc satisfies spec.arity
+     */
+    KeyRange key_range(const CommandSpec& spec, std::size_t argc) noexcept;
+
+    /**
+     * @brief Checks a request against its spec in a single pass.
+     *
+     * Every argument must be a BulkString and the argument count must satisfy the arity.
+     * Commands only have to check what the spec cannot express (options, value formats).
+     *
+     * @return std::nullopt if the request is well formed, or a CommandError:
+     *         - InvalidArgument if an argument is not a BulkString
+     *         - WrongArgumentCount if the argument count does not match the arity
+     */
+    std::optional<CommandError> check_arguments(const CommandSpec& spec, const protocol::ArrayRef& args);
+
+}
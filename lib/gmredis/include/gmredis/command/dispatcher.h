@@ -0,0 +1,86 @@
+#pragma once
+
+#include "gmredis/command/command_selector.h"
+#include "gmredis/command/slowlog.h"
+#include "gmredis/command/stats.h"
+#include "gmredis/protocol/reply_sink.h"
+#include "gmredis/protocol/resp_v3.h"
+#include "gmredis/protocol/tape.h"
+#include "gmredis/storage/kv.h"
+#include <memory>
+
+namespace gmredis::command {
+
+    /**
+     * @brief Runs a parsed request through select → validate → execute and produces the reply.
+     *
+     * The dispatcher is the single entry point the network layer uses to execute commands. Every
+     * failure along the way (unknown command, bad arguments, execution error) is turned into a
+     * RESP error reply, so callers always get something to send back to the client.
+     *
+     * The dispatcher holds no per-request state and may be shared by every connection, provided
+     * the selector and the commands it returns are safe to use concurrently.
+     */
+    class CommandDispatcher {
+    public:
+        /**
+         * @param selector Resolves requests to commands
+         * @param stats The statistics the selector's commands record into, if any; the network
+         *              layer adds its connection and traffic counters to the same object
+         */
+        explicit CommandDispatcher(std::shared_ptr<CommandSelector> selector, std::shared_ptr<Stats> stats = nullptr)
+            : selector_(std::move(selector)), stats_(std::move(stats)) {}
+
+        /**
+         * @brief Executes the request and returns the reply to send to the client.
+         *
+         * @param request The RESP array received from the client (command name + arguments),
+         *                usually read in place from the parser's tape
+         * @return The command result, or a SimpleError describing why it could not be executed
+         */
+        protocol::RespValue dispatch(const protocol::ArrayRef& request);
+
+        /**
+         * @brief Executes the request, encoding the reply straight into sink.
+         *
+         * This is the network path: commands stream their replies through
+         * Command::executeInto(), so no RespValue is built for them. When a command fails after
+         * writing part of its reply, that part is dropped before the error is written.
+         *
+         * @param request The RESP array received from the client
+         * @param sink Where exactly one reply is written
+         */
+        void dispatch(const protocol::ArrayRef& request, protocol::ReplySink& sink);
+
+        /**
+         * @brief Convenience overload for callers holding an owning request.
+         */
+        protocol::RespValue dispatch(const protocol::Array& request);
+
+        /**
+         * @brief The server statistics, or nullptr when they are not collected.
+         */
+        [[nodiscard]] Stats* stats() const noexcept { return stats_.get(); }
+
+    private:
+        std::shared_ptr<CommandSelector> selector_;
+        std::shared_ptr<Stats> stats_;
+    };
+
+    /**
+     * @brief Converts a CommandError into the RESP error reply sent to clients ("ERR <message>").
+     */
+    protocol::SimpleError to_error_reply(const CommandError& error);
+
+    /**
+     * @brief Creates a CommandSelector with every built-in command registered.
+     *
+     * @param store The key-value store used by data commands (GET, SET, ...)
+     * @param stats When set, every command records into it and INFO reports it
+     * @param slowlog When set, every command records slow executions into it and SLOWLOG
+     *                reports it
+     */
+    std::shared_ptr<CommandSelector> make_command_selector(std::shared_ptr<storage::KVStore> store,
+                                                           std::shared_ptr<Stats> stats = nullptr,
+                                                           std::shared_ptr<SlowLog> slowlog = nullptr);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include "gmredis/storage/kv.h"
+#include <memory>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis GET command.
+     *
+     * **Command format:**
+     * - `GET <key>` → BulkString holding the value, or Null if the key does not exist
+     *
+     * **Validation rules:**
+     * - Exactly one argument (plus the command name itself) and BulkStrings only, checked
+     *   against the spec (command_spec.h) before the command is selected
+     *
+     * The reply is streamed from KVStore::read(): a value the store keeps in a shared buffer
+     * is referenced by the reply rather than copied into it.
+     *
+     * @see SetCommand
+     */
+    class GetCommand : public BaseCommand {
+    public:
+        /**
+         * @param store The key-value store GET reads from
+         */
+        explicit GetCommand(std::shared_ptr<storage::KVStore> store) : store_(std::move(store)) {}
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+        std::optional<CommandError> doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) override;
+
+    private:
+        std::shared_ptr<storage::KVStore> store_;
+    };
+}
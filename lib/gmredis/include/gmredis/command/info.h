@@ -0,0 +1,41 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include "gmredis/command/stats.h"
+#include <memory>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis INFO command, for the sections backed by Stats.
+     *
+     * **Command format:**
+     * - `INFO` / `INFO all` / `INFO everything` / `INFO default` → every section below
+     * - `INFO <section> [section ...]` → the named sections; unknown names are ignored
+     *
+     * **Sections:**
+     * - `stats`: total_connections_received, total_commands_processed,
+     *   instantaneous_ops_per_sec, total_net_input_bytes, total_net_output_bytes
+     * - `commandstats`: one `cmdstat_<name>:calls=,usec=,usec_per_call=,rejected_calls=,failed_calls=`
+     *   line per command that has been called or rejected
+     * - `latencystats`: one `latency_percentiles_usec_<name>:p50=,p99=,p99.9=` line per command
+     *   that has been called, and `request_latency_percentiles_usec` for whole requests (parse
+     *   to reply written)
+     *
+     * The reply is a BulkString in the Redis layout: `# Section` headers, `field:value` lines
+     * and a blank line between sections.
+     */
+    class InfoCommand : public BaseCommand {
+    public:
+        /**
+         * @param stats The statistics to report; when null every counter reads 0
+         */
+        explicit InfoCommand(std::shared_ptr<Stats> stats) : stats_(std::move(stats)) {}
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+
+    private:
+        std::shared_ptr<Stats> stats_;
+    };
+}
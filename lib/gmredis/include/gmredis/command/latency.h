@@ -0,0 +1,34 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include "gmredis/command/stats.h"
+#include <memory>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis LATENCY command, for the histograms kept in Stats.
+     *
+     * **Command format:**
+     * - `LATENCY HISTOGRAM` → the histogram of every command that has been called
+     * - `LATENCY HISTOGRAM name [name ...]` → the histograms of the named commands; unknown or
+     *   never called commands are left out
+     *
+     * The reply uses the RESP2 layout of Redis: an Array alternating a command name and
+     * `["calls", count, "histogram_usec", [bound, cumulative count, ...]]`, where the bounds
+     * are powers of two in microseconds and only bounds that add calls are listed.
+     */
+    class LatencyCommand : public BaseCommand {
+    public:
+        /**
+         * @param stats The statistics to report; when null no command has a histogram
+         */
+        explicit LatencyCommand(std::shared_ptr<Stats> stats) : stats_(std::move(stats)) {}
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+
+    private:
+        std::shared_ptr<Stats> stats_;
+    };
+}
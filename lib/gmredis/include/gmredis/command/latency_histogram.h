@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace gmredis::command {
+
+    /**
+     * @brief Bucket layout shared by LatencyHistogram and HistogramSnapshot.
+     *
+     * HDR-style log-linear buckets over nanoseconds: values below 2 * sub_bucket_count have a
+     * bucket each, and every power of two above is split into sub_bucket_count equal buckets.
+     * A recorded value is therefore off by at most 1/sub_bucket_count (6.25%) of itself,
+     * from 1 ns up to max_trackable_ns (~68 s); larger values land in the last bucket.
+     */
+    namespace latency_buckets {
+        inline constexpr unsigned sub_bucket_bits = 4;
+        inline constexpr std::uint64_t sub_bucket_count = std::uint64_t{1} << sub_bucket_bits;
+        inline constexpr unsigned max_value_bits = 36;
+        inline constexpr std::uint64_t max_trackable_ns = (std::uint64_t{1} << max_value_bits) - 1;
+
+        /**
+         * @brief The bucket of a value in nanoseconds: a bit_width, a shift and an add.
+         */
+        constexpr std::size_t index_of(std::uint64_t ns) noexcept {
+            ns = std::min(ns, max_trackable_ns);
+            const auto width = static_cast<unsigned>(std::bit_width(ns));
+            const auto shift = width > sub_bucket_bits + 1 ? width - sub_bucket_bits - 1 : 0;
+            return (std::size_t{shift} << sub_bucket_bits) + static_cast<std::size_t>(ns >> shift);
+        }
+
+        inline constexpr std::size_t count = index_of(max_trackable_ns) + 1;
+
+        /** Log2 of the width of bucket index. */
+        constexpr unsigned shift_of(std::size_t index) noexcept {
+            return index < 2 * sub_bucket_count ? 0 : static_cast<unsigned>(index >> sub_bucket_bits) - 1;
+        }
+
+        /** Smallest value in bucket index. */
+        constexpr std::uint64_t lowest_of(std::size_t index) noexcept {
+            if (index < 2 * sub_bucket_count) {
+                return index;
+            }
+            return ((index & (sub_bucket_count - 1)) | sub_bucket_count) << shift_of(index);
+        }
+
+        /** Largest value in bucket index. */
+        constexpr std::uint64_t highest_of(std::size_t index) noexcept {
+            return lowest_of(index) + (std::uint64_t{1} << shift_of(index)) - 1;
+        }
+    }
+
+    /**
+     * @brief Totals of one or more LatencyHistograms, with percentile queries.
+     */
+    struct HistogramSnapshot {
+        std::array<std::uint64_t, latency_buckets::count> buckets{};
+
+        [[nodiscard]] std::uint64_t total() const noexcept;
+
+        /**
+         * @brief The smallest value, in nanoseconds, that at least percentile % of the recorded
+         *        values do not exceed, rounded up to the end of its bucket; 0 when empty.
+         *
+         * @param percentile In [0, 100], e.g. 99.9
+         */
+        [[nodiscard]] std::uint64_t value_at_percentile(double percentile) const noexcept;
+    };
+
+    /**
+     * @brief Log-bucketed latency histogram with a single writer.
+     *
+     * Only one thread records into a histogram (Stats gives every thread its own), so
+     * recording is a relaxed load and store of one bucket: no locked instruction, no CAS loop.
+     * Any thread may read it concurrently through add_to().
+     */
+    class LatencyHistogram {
+    public:
+        /**
+         * @brief Records count values of ns, e.g. every request of one pipelined batch at once.
+         */
+        void record(std::uint64_t ns, std::uint64_t count = 1) noexcept {
+            auto& bucket = buckets_[latency_buckets::index_of(ns)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Adds this histogram's buckets to snapshot.
+         */
+        void add_to(HistogramSnapshot& snapshot) const noexcept;
+
+    private:
+        std::array<std::atomic<std::uint64_t>, latency_buckets::count> buckets_{};
+    };
+
+}
@@ -9,7 +9,7 @@ namespace gmredis::command {
      * The PING command is used to test connectivity and verify that the server is responsive.
      * It supports two modes of operation:
      *
-     * 1. **Simple ping**: Without arguments, returns "PONG" as a SimpleString
+     * 1. **Simple ping**: Without arguments, returns the shared "+PONG" reply
      * 2. **Echo mode**: With one argument, echoes back that argument as a BulkString
      *
      * This command is commonly used for:
@@ -18,28 +18,29 @@ namespace gmredis::command {
      * - Testing command processing in echo mode
      *
      * **Command format:**
-     * - `PING` → Returns SimpleString "PONG"
+     * - `PING` → Returns "+PONG" (protocol::shared::pong)
      * - `PING <message>` → Returns BulkString containing <message>
      *
      * **Validation rules:**
      * - Accepts 0 or 1 arguments (plus the command name itself)
-     * - All arguments must be BulkString type
+     * - All arguments must be BulkString type, checked against the spec (command_spec.h)
+     *   before the command is selected
      *
      * @example
      * ```cpp
      * auto pingCmd = PingCommand();
      *
      * // Simple ping
-     * auto arg1 = protocol::Array{.values = {
-     *     protocol::BulkString{.value = "PING", .length = 4}
+     * auto arg1 = protocol::ArrayView{.values = {
+     *     protocol::BulkStringView{.value = "PING"}
      * }};
      * auto result1 = pingCmd.execute(arg1);
-     * // Returns: SimpleString{.value = "PONG"}
+     * // Returns: protocol::shared::pong
      *
      * // Echo mode
-     * auto arg2 = protocol::Array{.values = {
-     *     protocol::BulkString{.value = "PING", .length = 4},
-     *     protocol::BulkString{.value = "hello", .length = 5}
+     * auto arg2 = protocol::ArrayView{.values = {
+     *     protocol::BulkStringView{.value = "PING"},
+     *     protocol::BulkStringView{.value = "hello"}
      * }};
      * auto result2 = pingCmd.execute(arg2);
      * // Returns: BulkString{.value = "hello", .length = 5}
@@ -52,33 +53,31 @@ namespace gmredis::command {
         /**
          * @brief Validates PING command arguments.
          *
-         * Ensures that:
-         * - The argument array contains at most 2 elements (command + optional argument)
-         * - All arguments are of type BulkString
+         * Ensures that the argument array contains at most 2 elements (command + optional
+         * argument); the spec only requires at least one.
          *
          * @param arg The command arguments including the command name at index 0
-         * @return std::nullopt if validation succeeds, or a CommandError if:
-         *         - More than 1 argument is provided (WrongArgumentCount)
-         *         - Any argument is not a BulkString (InvalidArgument)
+         * @return std::nullopt if validation succeeds, or a CommandError (WrongArgumentCount)
+         *         if more than 1 argument is provided
          */
-        std::optional<CommandError> doValidate(const protocol::Array& arg) override;
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
 
         /**
          * @brief Executes the PING command.
          *
          * Behavior depends on the number of arguments:
-         * - If only the command name is present (arg.values.size() == 1):
-         *   Returns SimpleString "PONG"
-         * - If an argument is provided (arg.values.size() == 2):
+         * - If only the command name is present (arg.size() == 1):
+         *   Returns the shared "+PONG" reply
+         * - If an argument is provided (arg.size() == 2):
          *   Returns the argument at index 1 as a BulkString (echo mode)
          *
          * @param arg The validated command arguments
          * @return Expected containing:
-         *         - SimpleString{.value = "PONG"} for simple ping
+         *         - protocol::shared::pong for simple ping
          *         - BulkString with the echoed message for echo mode
          *
          * @note This method assumes validation has already succeeded
          */
-        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::Array& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
     };
 }
\ No newline at end of file
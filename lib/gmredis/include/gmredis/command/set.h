@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include "gmredis/storage/kv.h"
+#include <memory>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis SET command.
+     *
+     * **Command format:**
+     * - `SET <key> <value>` → "+OK" (protocol::shared::ok)
+     *
+     * Expiry and conditional options (EX, PX, NX, XX, ...) are not supported yet.
+     *
+     * **Validation rules:**
+     * - At least two arguments (plus the command name itself) and BulkStrings only, checked
+     *   against the spec (command_spec.h) before the command is selected
+     * - Any argument after the value is an unsupported option: "syntax error"
+     *
+     * @see GetCommand
+     */
+    class SetCommand : public BaseCommand {
+    public:
+        /**
+         * @param store The key-value store SET writes to
+         */
+        explicit SetCommand(std::shared_ptr<storage::KVStore> store) : store_(std::move(store)) {}
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+
+    private:
+        std::shared_ptr<storage::KVStore> store_;
+    };
+}
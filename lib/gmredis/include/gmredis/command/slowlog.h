@@ -0,0 +1,147 @@
+#pragma once
+
+#include "gmredis/protocol/tape.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace gmredis::command {
+
+    /**
+     * @brief Names the client whose requests the calling thread is executing.
+     *
+     * Commands do not see their connection, so the network layer opens a scope around each
+     * batch it executes and the slow log reads the address from here. Scopes nest; the
+     * address must outlive the scope.
+     */
+    class ClientScope {
+    public:
+        explicit ClientScope(std::string_view address) noexcept : previous_(std::exchange(current_, address)) {}
+        ~ClientScope() { current_ = previous_; }
+
+        ClientScope(const ClientScope&) = delete;
+        ClientScope& operator=(const ClientScope&) = delete;
+
+        /** "ip:port" of the current client, or empty outside any scope. */
+        static std::string_view current() noexcept { return current_; }
+
+    private:
+        static inline thread_local std::string_view current_{};
+        std::string_view previous_;
+    };
+
+    /**
+     * @brief One slow log entry, copied out of the ring.
+     */
+    struct SlowLogEntry {
+        std::uint64_t id = 0;
+        /** Unix time, in seconds, at which the command finished. */
+        std::int64_t timestamp = 0;
+        std::uint64_t duration_us = 0;
+        /** The arguments, truncated as described in SlowLog. */
+        std::vector<std::string> arguments;
+        std::string client_address;
+
+        bool operator==(const SlowLogEntry&) const = default;
+    };
+
+    /**
+     * @brief Fixed-size ring of the most recent commands that ran for at least a threshold.
+     *
+     * Like Redis, an entry keeps at most max_arguments arguments (the last one replaced by
+     * "... (N more arguments)") and max_argument_length bytes of each ("... (N more bytes)").
+     * Every slot is allocated up front with room for that much, so recording never allocates.
+     *
+     * Writers claim an id with one fetch_add and copy into slot id % capacity, which only they
+     * touch unless the ring wraps around during the copy or a reader is copying that slot out.
+     * A writer never waits: if the slot is busy, the entry is dropped. Readers wait for the
+     * (short) copy of a busy slot.
+     *
+     * @example
+     * ```cpp
+     * auto slowlog = std::make_shared<SlowLog>(std::chrono::microseconds(10000), 128);
+     * if (slowlog->is_slow(elapsed)) {
+     *     slowlog->record(args, elapsed);
+     * }
+     * auto newest = slowlog->entries(10);
+     * ```
+     */
+    class SlowLog {
+    public:
+        static constexpr std::size_t max_arguments = 32;
+        static constexpr std::size_t max_argument_length = 128;
+
+        /**
+         * @param threshold Commands running at least this long are recorded
+         * @param capacity Entries kept; older ones are overwritten (at least 1)
+         */
+        SlowLog(std::chrono::microseconds threshold, std::size_t capacity);
+
+        [[nodiscard]] bool is_slow(std::chrono::nanoseconds elapsed) const noexcept { return elapsed >= threshold_; }
+
+        /**
+         * @brief Adds an entry for the command args, attributed to ClientScope::current().
+         * @return Whether the entry was stored, false if it was dropped
+         */
+        bool record(const protocol::ArrayRef& args, std::chrono::nanoseconds elapsed) noexcept;
+
+        /**
+         * @brief Up to count entries, newest first.
+         */
+        [[nodiscard]] std::vector<SlowLogEntry> entries(std::size_t count) const;
+
+        /**
+         * @brief Number of entries currently in the log, as many as entries(capacity()) returns.
+         *        Dropped entries are not counted.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Forgets every entry recorded so far.
+         */
+        void reset() noexcept;
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        struct Slot {
+            mutable std::atomic<bool> busy{false};
+            /** Id + 1 of the entry held; 0 when empty. */
+            std::uint64_t sequence = 0;
+            std::int64_t timestamp = 0;
+            std::uint64_t duration_us = 0;
+            /** Arguments of the command, including those not kept. */
+            std::size_t argument_count = 0;
+            std::size_t kept_arguments = 0;
+            /** Original length of each kept argument. */
+            std::array<std::size_t, max_arguments> lengths{};
+            std::array<char, max_arguments * max_argument_length> bytes{};
+            std::array<char, 64> client{};
+            std::size_t client_length = 0;
+        };
+
+        /** Waits until no one else is copying into or out of slot, then claims it. */
+        static void acquire(const Slot& slot) noexcept;
+
+        /** Copies slot into entry if it still holds id. */
+        bool read(const Slot& slot, std::uint64_t id, SlowLogEntry& entry) const;
+
+        /** The lowest id still in the log when next_id_ is next. */
+        [[nodiscard]] std::uint64_t oldest_id(std::uint64_t next) const noexcept;
+
+        const std::chrono::nanoseconds threshold_;
+        const std::size_t capacity_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<std::uint64_t> next_id_{0};
+        /** Entries with a lower id were reset. */
+        std::atomic<std::uint64_t> first_id_{0};
+    };
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "gmredis/command/base_command.h"
+#include "gmredis/command/slowlog.h"
+#include <memory>
+
+namespace gmredis::command {
+    /**
+     * @brief Implementation of the Redis SLOWLOG command.
+     *
+     * **Command format:**
+     * - `SLOWLOG GET [count]` → the count (default 10, -1 for all) newest entries, newest first
+     * - `SLOWLOG LEN` → the number of entries, as an Integer
+     * - `SLOWLOG RESET` → empties the log, replies OK
+     *
+     * Each entry has the Redis layout: id, Unix timestamp, duration in microseconds, the
+     * (truncated) arguments, the client address and the client name, which is always empty.
+     * Entries are streamed into the ReplySink as they are copied out of the log.
+     */
+    class SlowLogCommand : public BaseCommand {
+    public:
+        /**
+         * @param slowlog The log to report; when null the log is always empty
+         */
+        explicit SlowLogCommand(std::shared_ptr<SlowLog> slowlog) : slowlog_(std::move(slowlog)) {}
+
+    protected:
+        std::optional<CommandError> doValidate(const protocol::ArrayRef& arg) override;
+        std::expected<protocol::RespValue, CommandError> doExecute(const protocol::ArrayRef& arg) override;
+        std::optional<CommandError> doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) override;
+
+    private:
+        std::shared_ptr<SlowLog> slowlog_;
+    };
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "gmredis/command/command.h"
+#include "gmredis/command/latency_histogram.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gmredis::command {
+
+    /**
+     * @brief Counters of one command, as reported by INFO commandstats.
+     */
+    struct CommandCounters {
+        std::uint64_t calls = 0;
+        /** Time spent executing, in nanoseconds. */
+        std::uint64_t nanoseconds = 0;
+        /** Requests refused before execution (arity, argument types, syntax). */
+        std::uint64_t rejected_calls = 0;
+        /** Executions that returned an error. */
+        std::uint64_t failed_calls = 0;
+
+        bool operator==(const CommandCounters&) const = default;
+    };
+
+    /**
+     * @brief Totals of every thread's counters at one point in time.
+     */
+    struct StatsSnapshot {
+        std::array<CommandCounters, command_type_count> commands{};
+        std::uint64_t connections_received = 0;
+        std::uint64_t net_input_bytes = 0;
+        std::uint64_t net_output_bytes = 0;
+
+        [[nodiscard]] std::uint64_t total_commands_processed() const noexcept;
+    };
+
+    /**
+     * @brief Totals of every thread's latency histograms at one point in time.
+     */
+    struct LatencySnapshot {
+        /** Time spent in Command::execute(), per command. */
+        std::array<HistogramSnapshot, command_type_count> commands{};
+        /** Time from parsing a request to its reply being written to the socket. */
+        HistogramSnapshot requests{};
+    };
+
+    /**
+     * @brief Server-wide statistics, recorded into per-thread counters and summed on read.
+     *
+     * Each thread that records gets its own cache-line aligned shard the first time it does
+     * so. A shard has a single writer, so recording is a plain load and store of a relaxed
+     * atomic: no locked instructions and no cache lines bouncing between io threads. Reads
+     * (INFO) lock the shard list and add the shards up; they may observe a request half
+     * recorded, which is fine for monitoring.
+     *
+     * Every shard also holds a latency histogram per command and one for whole requests
+     * (LatencyHistogram); recording into them has the same single-writer cost.
+     *
+     * Shards are kept until the Stats object is destroyed, so counts survive their threads.
+     *
+     * @example
+     * ```cpp
+     * auto stats = std::make_shared<Stats>();
+     * stats->record_call(CommandType::Get, 1200, false);   // on an io thread
+     * auto calls = stats->snapshot().commands[static_cast<std::size_t>(CommandType::Get)].calls;
+     * ```
+     */
+    class Stats {
+    public:
+        Stats();
+
+        Stats(const Stats&) = delete;
+        Stats& operator=(const Stats&) = delete;
+
+        void record_call(CommandType type, std::uint64_t nanoseconds, bool failed) noexcept {
+            auto& shard = local();
+            auto& counters = shard.commands[static_cast<std::size_t>(type)];
+            shard.command_latency[static_cast<std::size_t>(type)].record(nanoseconds);
+            add(counters.calls, 1);
+            add(counters.nanoseconds, nanoseconds);
+            if (failed) {
+                add(counters.failed_calls, 1);
+            }
+        }
+
+        void record_rejected(CommandType type) noexcept {
+            add(local().commands[static_cast<std::size_t>(type)].rejected_calls, 1);
+        }
+
+        void record_connection() noexcept { add(local().connections_received, 1); }
+        void record_input(std::size_t bytes) noexcept { add(local().net_input_bytes, bytes); }
+        void record_output(std::size_t bytes) noexcept { add(local().net_output_bytes, bytes); }
+
+        /**
+         * @brief Records the latency of count requests whose replies were written together.
+         */
+        void record_requests(std::uint64_t nanoseconds, std::uint64_t count) noexcept {
+            local().request_latency.record(nanoseconds, count);
+        }
+
+        /**
+         * @brief Sums the counters of every thread.
+         */
+        [[nodiscard]] StatsSnapshot snapshot() const;
+
+        /**
+         * @brief Sums the latency histograms of every thread.
+         */
+        [[nodiscard]] LatencySnapshot latency_snapshot() const;
+
+        /**
+         * @brief Commands per second since the previous call (or since construction).
+         *
+         * There is no background sampling; INFO calls this, so the rate covers the interval
+         * between two INFO requests. Calls less than 100ms apart return the previous rate.
+         */
+        double sample_ops_per_sec();
+
+    private:
+        struct AtomicCommandCounters {
+            std::atomic<std::uint64_t> calls{0};
+            std::atomic<std::uint64_t> nanoseconds{0};
+            std::atomic<std::uint64_t> rejected_calls{0};
+            std::atomic<std::uint64_t> failed_calls{0};
+        };
+
+        struct alignas(64) Shard {
+            std::array<AtomicCommandCounters, command_type_count> commands;
+            std::atomic<std::uint64_t> connections_received{0};
+            std::atomic<std::uint64_t> net_input_bytes{0};
+            std::atomic<std::uint64_t> net_output_bytes{0};
+            std::array<LatencyHistogram, command_type_count> command_latency;
+            LatencyHistogram request_latency;
+        };
+
+        /** Single writer: no read-modify-write needed. */
+        static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        Shard& local() noexcept {
+            // One entry per thread: recording into one Stats object from a thread is a
+            // compare and a load. Alternating between instances (tests) falls back to attach().
+            thread_local std::pair<std::uint64_t, Shard*> cache{0, nullptr};
+            if (cache.first != id_) {
+                cache = {id_, &attach()};
+            }
+            return *cache.second;
+        }
+
+        Shard& attach();
+
+        /** Unique per instance, so a cached shard of a destroyed Stats is never reused. */
+        const std::uint64_t id_;
+        mutable std::mutex mutex_;
+        std::vector<std::pair<std::thread::id, std::unique_ptr<Shard>>> shards_;
+
+        std::mutex rate_mutex_;
+        std::chrono::steady_clock::time_point sampled_at_;
+        std::uint64_t sampled_commands_ = 0;
+        double ops_per_sec_ = 0;
+    };
+
+}
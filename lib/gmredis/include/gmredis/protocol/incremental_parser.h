@@ -0,0 +1,135 @@
+#pragma once
+
+#include "gmredis/protocol/limits.h"
+#include "gmredis/protocol/parse.h"
+#include "gmredis/protocol/resp_view.h"
+#include "gmredis/protocol/tape.h"
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string_view>
+#include <vector>
+
+namespace gmredis::protocol {
+
+    /**
+     * @brief Resumable RESP parser for frames that arrive in pieces.
+     *
+     * parse() is handed the bytes of the current frame received so far, always starting at the
+     * frame's first byte. When the frame is incomplete the parser remembers how far it got
+     * (the nesting of open arrays, the elements each still expects, a pending bulk length and
+     * where a partial header line was last scanned) and the next call continues from there
+     * instead of starting over, so a frame costs O(size) in total no matter how it is split.
+     * A pending bulk payload is not scanned at all: its end is known from the length header.
+     * Declared lengths, header lines, nesting depth and the frame size are checked against
+     * ProtocolLimits as soon as they are read, so nothing is buffered or reserved on the
+     * strength of an oversized header, and a frame of many small elements is cut off at
+     * max_frame_length.
+     *
+     * Positions are kept as offsets from the start of the frame, so the bytes may move
+     * between calls (e.g. when a ReadBuffer compacts or grows) as long as the bytes already
+     * passed in are unchanged.
+     *
+     * Elements are recorded on a flat Tape as they are parsed; parse_tape() hands that tape
+     * out as is, parse() turns it into a RespValueView. Neither recurses, so deeply nested
+     * input cannot exhaust the stack. Once a frame is complete, the parser starts over with
+     * the next call. Storage for the tape and array stack is kept across frames.
+     *
+     * @example
+     * ```cpp
+     * IncrementalParser parser;
+     * auto result = parser.parse(buffer.data());
+     * if (result.has_value()) {
+     *     handle(*result);                      // views into buffer.data()
+     *     buffer.consume(parser.frame_size());
+     * } else if (result.error() == ParseError::Incomplete) {
+     *     // read more, then call parse() again with the grown buffer
+     * }
+     * ```
+     */
+    class IncrementalParser {
+    public:
+        explicit IncrementalParser(ProtocolLimits limits = {}) : limits_(limits) {}
+
+        /**
+         * @brief Continues parsing the current frame.
+         *
+         * @param input The bytes of the current frame received so far, starting at its first
+         *              byte; may extend past the end of the frame.
+         * @return The complete value, viewing input; ParseError::Incomplete if more bytes are
+         *         needed (progress is kept); Invalid or Unsupported on malformed input and
+         *         LimitExceeded when a header or line is beyond the ProtocolLimits, after
+         *         which the parser is reset.
+         */
+        std::expected<RespValueView, ParseError> parse(std::string_view input);
+
+        /**
+         * @brief Like parse(), but leaves the complete frame on tape() instead of building a
+         *        value, so reading a request allocates nothing once the tape has grown.
+         */
+        std::expected<void, ParseError> parse_tape(std::string_view input);
+
+        /**
+         * @brief The frame completed by the last successful parse_tape() or parse(); valid
+         *        until the next call and while the frame bytes are.
+         */
+        [[nodiscard]] const Tape& tape() const noexcept { return tape_; }
+
+        /**
+         * @brief Size in bytes of the frame returned by the last successful parse().
+         */
+        [[nodiscard]] std::size_t frame_size() const noexcept { return frame_size_; }
+
+        /**
+         * @brief Whether part of a frame has been parsed and the parser is waiting for more.
+         */
+        [[nodiscard]] bool in_progress() const noexcept { return offset_ != 0 || scan_from_ != 0; }
+
+        /**
+         * @brief Length of the bulk payload the parser is waiting for, or 0 when it is not
+         *        inside one.
+         */
+        [[nodiscard]] std::size_t pending_bulk_length() const noexcept {
+            return in_bulk_payload_ ? pending_bulk_length_ : 0;
+        }
+
+        /**
+         * @brief Frame bytes, counted from the frame's first byte, needed to finish the
+         *        pending bulk payload (including its CRLF), or 0 when there is none.
+         */
+        [[nodiscard]] std::size_t pending_bulk_end() const noexcept {
+            return in_bulk_payload_ ? offset_ + pending_bulk_length_ + 2 : 0;
+        }
+
+        /**
+         * @brief Abandons the current frame.
+         */
+        void reset() noexcept;
+
+    private:
+        /** An array still receiving children. */
+        struct OpenArray {
+            std::size_t index;
+            std::size_t remaining;
+        };
+
+        bool complete_element() noexcept;
+        void finish(std::string_view input) noexcept;
+        std::unexpected<ParseError> fail(ParseError error) noexcept;
+
+        ProtocolLimits limits_;
+        Tape tape_;
+        /** Open arrays, outermost first. */
+        std::vector<OpenArray> open_arrays_;
+        /** Whether tape_ holds a complete frame, to be cleared when the next one starts. */
+        bool complete_ = false;
+        /** Start of the next element (or of the pending bulk payload). */
+        std::size_t offset_ = 0;
+        /** Where to resume looking for the CRLF of a partially received header line. */
+        std::size_t scan_from_ = 0;
+        std::size_t pending_bulk_length_ = 0;
+        bool in_bulk_payload_ = false;
+        std::size_t frame_size_ = 0;
+    };
+
+}
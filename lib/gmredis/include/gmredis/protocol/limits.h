@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace gmredis::protocol {
+
+    /**
+     * @brief Upper bounds on what a client may declare or send, checked while parsing.
+     *
+     * Lengths are checked as soon as a header is read, before any memory is set aside for
+     * the value, so a single `*2147483647` or `$4294967296` cannot make a connection reserve
+     * gigabytes. The per-element limits alone do not bound a frame: nested arrays multiply
+     * element counts, and simple strings and integers need no declared length. max_frame_length
+     * caps the bytes of a frame however they are made up, checked as each header arrives, and
+     * with it the parse tape, which has at most one element per three frame bytes.
+     * max_nesting_depth caps how deep arrays nest. The defaults match Redis where it has an
+     * equivalent setting.
+     */
+    struct ProtocolLimits {
+        /** Largest bulk string payload in bytes (Redis `proto-max-bulk-len`). */
+        std::size_t max_bulk_length = 512 * 1024 * 1024;
+
+        /** Largest number of elements in an array header (Redis' multibulk length limit). */
+        std::size_t max_multibulk_length = 1024 * 1024;
+
+        /** Longest header or simple value line, without its CRLF (Redis' inline limit). */
+        std::size_t max_inline_length = 64 * 1024;
+
+        /** Most arrays a frame may nest, counting the outermost; requests need 1. */
+        std::size_t max_nesting_depth = 32;
+
+        /** Largest frame in bytes, headers included (Redis `client-query-buffer-limit`). */
+        std::size_t max_frame_length = 1024 * 1024 * 1024;
+    };
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gmredis/protocol/resp_v3.h"
+#include "gmredis/protocol/resp_view.h"
 #include <string_view>
 #include <expected>
 #include <array>
@@ -9,10 +10,13 @@ namespace gmredis::protocol {
     enum class ParseError {
         Incomplete,
         Invalid,
-        Unsupported
+        Unsupported,
+        /** A declared length or a line is beyond the configured ProtocolLimits. */
+        LimitExceeded
     };
 
     using Parser = std::expected<RespValue, ParseError>(*)(std::string_view&);
+    using ViewParser = std::expected<RespValueView, ParseError>(*)(std::string_view&);
 
     std::expected<RespValue, ParseError> parse_simple_string(std::string_view &input);
     std::expected<RespValue, ParseError> parse_error(std::string_view &input);
@@ -20,6 +24,17 @@ namespace gmredis::protocol {
     std::expected<RespValue, ParseError> parse_integer(std::string_view &input);
     std::expected<RespValue, ParseError> parse_array(std::string_view &input);
 
+    /*
+     * Zero-copy parsers: the returned views point into input's underlying buffer, which must
+     * stay alive and unmodified for as long as the result is used (see resp_view.h). The
+     * owning parsers above are these plus a copy of the payloads.
+     */
+    std::expected<RespValueView, ParseError> parse_simple_string_view(std::string_view &input);
+    std::expected<RespValueView, ParseError> parse_error_view(std::string_view &input);
+    std::expected<RespValueView, ParseError> parse_bulk_string_view(std::string_view &input);
+    std::expected<RespValueView, ParseError> parse_integer_view(std::string_view &input);
+    std::expected<RespValueView, ParseError> parse_array_view(std::string_view &input);
+
     constexpr auto make_parser_table() {
         std::array<Parser, 128> table{};
         table['+'] = parse_simple_string;
@@ -30,8 +45,24 @@ namespace gmredis::protocol {
         return table;
     }
 
+    constexpr auto make_view_parser_table() {
+        std::array<ViewParser, 128> table{};
+        table['+'] = parse_simple_string_view;
+        table['-'] = parse_error_view;
+        table['$'] = parse_bulk_string_view;
+        table[':'] = parse_integer_view;
+        table['*'] = parse_array_view;
+        return table;
+    }
+
     inline constexpr auto parser_table = make_parser_table();
+    inline constexpr auto view_parser_table = make_view_parser_table();
 
     std::expected<RespValue, ParseError> parse(std::string_view &input);
 
-}
\ No newline at end of file
+    /**
+     * @brief Parses one RESP value without copying its payloads; used on the request path.
+     */
+    std::expected<RespValueView, ParseError> parse_view(std::string_view &input);
+
+}
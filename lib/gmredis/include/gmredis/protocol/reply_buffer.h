@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmredis::protocol {
+
+    /**
+     * @brief Outgoing reply bytes that may reference large values instead of copying them.
+     *
+     * Replies are encoded into bytes() as usual. A value the store keeps in an immutable
+     * shared buffer can instead be spliced in by reference: the buffer holds on to it, and the
+     * backend writes bytes() and the referenced values together with one gather write. The
+     * references are dropped by clear() once that write has completed, so a value overwritten
+     * or deleted in the meantime is still sent intact.
+     *
+     * @example
+     * ```cpp
+     * ReplyBuffer output;
+     * output.bytes() += "$5\r\n";
+     * output.append_reference(std::make_shared<const std::string>("hello"));
+     * output.bytes() += "\r\n";
+     * output.for_each_chunk([](std::string_view chunk) { ... });  // "$5\r\n", "hello", "\r\n"
+     * ```
+     */
+    class ReplyBuffer {
+    public:
+        /** The encoded bytes, without the referenced values; append to it freely. */
+        [[nodiscard]] std::string& bytes() noexcept { return bytes_; }
+        [[nodiscard]] const std::string& bytes() const noexcept { return bytes_; }
+
+        /**
+         * @brief Splices value in after everything appended to bytes() so far, keeping it alive
+         *        until clear().
+         */
+        void append_reference(std::shared_ptr<const std::string> value);
+
+        /** Total length of the reply: bytes() and the referenced values. */
+        [[nodiscard]] std::size_t size() const noexcept { return bytes_.size() + referenced_; }
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+        [[nodiscard]] bool has_references() const noexcept { return !references_.empty(); }
+
+        /**
+         * @brief Drops the bytes past bytes_mark (a size of bytes()) and the values referenced
+         *        after them.
+         */
+        void rewind(std::size_t bytes_mark);
+
+        /**
+         * @brief Empties the buffer and releases the referenced values; keeps the capacity.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Calls visit(std::string_view) for each contiguous piece of the reply, in order.
+         */
+        template <typename Visitor>
+        void for_each_chunk(Visitor&& visit) const {
+            std::string_view const bytes = bytes_;
+            std::size_t start = 0;
+            for (const auto& reference : references_) {
+                if (reference.offset > start) {
+                    visit(bytes.substr(start, reference.offset - start));
+                    start = reference.offset;
+                }
+                visit(std::string_view(*reference.value));
+            }
+            if (start < bytes.size()) {
+                visit(bytes.substr(start));
+            }
+        }
+
+        /**
+         * @brief The whole reply as one string, for tests and callers that need it flat.
+         */
+        [[nodiscard]] std::string str() const;
+
+    private:
+        struct Reference {
+            /** Position in bytes_ the value is spliced in at. */
+            std::size_t offset;
+            std::shared_ptr<const std::string> value;
+        };
+
+        std::string bytes_;
+        std::vector<Reference> references_;
+        std::size_t referenced_ = 0;
+    };
+
+}
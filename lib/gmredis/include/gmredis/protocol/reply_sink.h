@@ -0,0 +1,83 @@
+#pragma once
+
+#include "reply_buffer.h"
+#include "resp_v3.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace gmredis::protocol {
+
+    /**
+     * @brief Encodes a reply element by element straight into an output buffer.
+     *
+     * Commands with large or variable replies write through a sink instead of building a
+     * RespValue tree for serialize_to() to walk again: every element is encoded once, as it
+     * is produced, and the only extra memory is what the elements themselves need. Array
+     * lengths are written up front, so the number of elements must be known before the first
+     * one is written.
+     *
+     * The sink does not own the buffer and keeps whatever was already in it; mark() and
+     * rewind() let a caller drop a partially written reply. Writing into a ReplyBuffer also
+     * lets bulk strings held in shared buffers be referenced rather than copied.
+     *
+     * @example
+     * ```cpp
+     * std::string output;
+     * ReplySink sink(output);
+     * sink.begin_array(2);
+     * sink.bulk("key");
+     * sink.integer(42);   // output == "*2\r\n$3\r\nkey\r\n:42\r\n"
+     * ```
+     */
+    class ReplySink {
+    public:
+        explicit ReplySink(std::string& output) noexcept : output_(output) {}
+        explicit ReplySink(ReplyBuffer& output) noexcept : output_(output.bytes()), references_(&output) {}
+
+        ReplySink(const ReplySink&) = delete;
+        ReplySink& operator=(const ReplySink&) = delete;
+
+        /** Starts an array; the next count elements written are its members. */
+        void begin_array(std::size_t count);
+        void bulk(std::string_view value);
+        /**
+         * @brief A bulk string whose payload stays in value: a ReplyBuffer keeps a reference
+         *        to it until the reply is written, a plain string gets a copy.
+         */
+        void bulk(const std::shared_ptr<const std::string>& value);
+        void simple_string(std::string_view value);
+        /** The message must not contain CR or LF, e.g. "ERR unknown command". */
+        void error(std::string_view message);
+        void integer(std::int64_t value);
+        /** Null bulk string ("$-1"). */
+        void null();
+        void write(const EncodedReply& reply);
+        /** Appends an already materialized value. */
+        void write(const RespValue& value);
+
+        /**
+         * @brief Position of the end of what has been written, for rewind().
+         */
+        [[nodiscard]] std::size_t mark() const noexcept { return output_.size(); }
+
+        /**
+         * @brief Drops everything written after mark.
+         */
+        void rewind(std::size_t mark) {
+            if (references_ != nullptr) {
+                references_->rewind(mark);
+            } else {
+                output_.resize(mark);
+            }
+        }
+
+    private:
+        std::string& output_;
+        /** The buffer output_ belongs to, when values may be referenced. */
+        ReplyBuffer* references_ = nullptr;
+    };
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -28,13 +29,30 @@ namespace gmredis::protocol {
         bool operator==(const Integer&) const = default;
     };
 
+    /** Null bulk string ("$-1"), e.g. the reply to GET on a missing key. */
+    struct Null {
+        bool operator==(const Null&) const = default;
+    };
+
+    /**
+     * A complete reply already in wire format, written out as is. The bytes are not owned;
+     * they are normally one of the static replies in shared_replies.h.
+     */
+    struct EncodedReply {
+        std::string_view bytes;
+
+        bool operator==(const EncodedReply&) const = default;
+    };
+
     struct Array;
 
     using RespValue = std::variant<SimpleString,
                                    SimpleError,
                                    BulkString,
                                    Integer,
-                                   Array>;
+                                   Array,
+                                   Null,
+                                   EncodedReply>;
 
     struct Array {
         std::vector<RespValue> values;
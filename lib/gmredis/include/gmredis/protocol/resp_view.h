@@ -0,0 +1,62 @@
+#pragma once
+
+#include "gmredis/protocol/resp_v3.h"
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace gmredis::protocol {
+
+    /*
+     * Non-owning counterparts of the resp_v3.h types, produced by parse_view().
+     *
+     * Payloads are string_views into the buffer that was parsed, so a view is only valid while
+     * that buffer is alive and unmodified. On the server this means until the request has been
+     * executed and the bytes are consumed from the connection's ReadBuffer. Values that must
+     * outlive the buffer are copied out explicitly (to_owned(), or std::string(view.value)).
+     */
+
+    struct SimpleStringView {
+        std::string_view value;
+
+        bool operator==(const SimpleStringView&) const = default;
+    };
+    struct SimpleErrorView {
+        std::string_view value;
+
+        bool operator==(const SimpleErrorView&) const = default;
+    };
+    struct BulkStringView {
+        std::string_view value;
+
+        bool operator==(const BulkStringView&) const = default;
+    };
+
+    struct ArrayView;
+
+    using RespValueView = std::variant<SimpleStringView,
+                                       SimpleErrorView,
+                                       BulkStringView,
+                                       Integer,
+                                       ArrayView,
+                                       Null>;
+
+    struct ArrayView {
+        std::vector<RespValueView> values;
+
+        bool operator==(const ArrayView&) const = default;
+    };
+
+    /**
+     * @brief Views the payloads of an owning value; the result must not outlive value.
+     */
+    RespValueView to_view(const RespValue& value);
+    ArrayView to_view(const Array& value);
+
+    /**
+     * @brief Copies the payloads of a view into an owning value.
+     */
+    RespValue to_owned(const RespValueView& value);
+    Array to_owned(const ArrayView& value);
+
+}
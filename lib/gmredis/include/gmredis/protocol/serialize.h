@@ -1,15 +1,49 @@
 #pragma once
 
 #include "resp_v3.h"
+#include <cstddef>
 #include <string>
 
 namespace gmredis::protocol {
 
+    /**
+     * @brief Number of bytes serialize_to() appends for resp.
+     */
+    std::size_t serialized_size(const RespValue& resp);
+
+    /**
+     * @brief Appends the RESP encoding of resp to output.
+     *
+     * The exact size is computed first, so output grows at most once and no temporary
+     * strings are built, however deeply the value nests. Reusing one output buffer across
+     * replies makes steady-state serialization allocation free.
+     *
+     * @example
+     * ```cpp
+     * std::string output;
+     * serialize_to(output, SimpleString{"OK"});     // "+OK\r\n"
+     * serialize_to(output, Integer{42});            // "+OK\r\n:42\r\n"
+     * ```
+     */
+    void serialize_to(std::string& output, const SimpleString& resp);
+    void serialize_to(std::string& output, const SimpleError& resp);
+    void serialize_to(std::string& output, const BulkString& resp);
+    void serialize_to(std::string& output, const Integer& resp);
+    void serialize_to(std::string& output, const Array& resp);
+    void serialize_to(std::string& output, const Null& resp);
+    void serialize_to(std::string& output, const EncodedReply& resp);
+    void serialize_to(std::string& output, const RespValue& resp);
+
+    /**
+     * @brief Returns the RESP encoding of resp as a new string; see serialize_to().
+     */
     std::string serialize(const SimpleString& resp);
     std::string serialize(const SimpleError& resp);
     std::string serialize(const BulkString& resp);
     std::string serialize(const Integer& resp);
     std::string serialize(const Array& resp);
+    std::string serialize(const Null& resp);
+    std::string serialize(const EncodedReply& resp);
     std::string serialize(const RespValue& resp);
 
-}
\ No newline at end of file
+}
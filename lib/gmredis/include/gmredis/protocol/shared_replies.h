@@ -0,0 +1,43 @@
+#pragma once
+
+#include "resp_v3.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace gmredis::protocol::shared {
+
+    /*
+     * Replies common enough to be encoded once. Commands return these instead of building
+     * a SimpleString or SimpleError per call; the serializer copies the bytes straight into
+     * the output buffer, with no formatting or allocation.
+     */
+
+    inline constexpr EncodedReply ok{"+OK\r\n"};
+    inline constexpr EncodedReply pong{"+PONG\r\n"};
+    inline constexpr EncodedReply null_bulk{"$-1\r\n"};
+    inline constexpr EncodedReply empty_bulk{"$0\r\n\r\n"};
+    inline constexpr EncodedReply empty_array{"*0\r\n"};
+
+    inline constexpr EncodedReply protocol_error{"-ERR Protocol error\r\n"};
+    inline constexpr EncodedReply limit_exceeded_error{"-ERR Protocol error: request exceeds protocol limits\r\n"};
+    inline constexpr EncodedReply expected_array_error{"-ERR Protocol error: expected an array of bulk strings\r\n"};
+    inline constexpr EncodedReply syntax_error{"-ERR syntax error\r\n"};
+    inline constexpr EncodedReply not_an_integer_error{"-ERR value is not an integer or out of range\r\n"};
+    inline constexpr EncodedReply wrong_type_error{"-WRONGTYPE Operation against a key holding the wrong kind of value\r\n"};
+
+    /** Integers in [0, integer_count) have a shared encoding. */
+    inline constexpr std::int64_t integer_count = 10000;
+
+    /**
+     * @brief The encoding of ":<value>\r\n" from a table built at compile time.
+     *
+     * @pre 0 <= value < integer_count
+     */
+    EncodedReply integer(std::int64_t value) noexcept;
+
+    /**
+     * @brief An integer reply, shared when value is in the table and an Integer otherwise.
+     */
+    RespValue integer_reply(std::int64_t value) noexcept;
+
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "gmredis/protocol/resp_view.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace gmredis::protocol {
+
+    class ArrayRef;
+
+    enum class TapeKind : std::uint8_t { SimpleString, SimpleError, BulkString, Integer, Array, Null };
+
+    /**
+     * @brief One value of a frame on a Tape.
+     */
+    struct TapeElement {
+        TapeKind kind;
+        /** Strings: payload offset from the start of the frame. */
+        std::size_t offset = 0;
+        /** Strings: payload length. Arrays: number of children. */
+        std::size_t length = 0;
+        std::int64_t integer = 0;
+        /** Arrays: tape index one past their last descendant, so siblings can be skipped. */
+        std::size_t end = 0;
+    };
+
+    /**
+     * @brief A parsed frame as a flat list of elements in pre-order, viewing the frame bytes.
+     *
+     * An array is followed by its children (and theirs), so a request such as
+     * `SET key value` is four contiguous elements rather than a tree of variants. The
+     * element storage is reused from frame to frame, which makes reading a request free of
+     * allocations; IncrementalParser::parse_tape() fills it.
+     *
+     * Like the view types, a tape is only valid while the frame bytes are.
+     */
+    struct Tape {
+        /** The frame the element offsets refer to. */
+        std::string_view input;
+        std::vector<TapeElement> elements;
+
+        [[nodiscard]] bool is_array(std::size_t index = 0) const noexcept {
+            return index < elements.size() && elements[index].kind == TapeKind::Array;
+        }
+
+        /**
+         * @brief Index of the element that follows index and all of its descendants.
+         */
+        [[nodiscard]] std::size_t next(std::size_t index) const noexcept {
+            return elements[index].kind == TapeKind::Array ? elements[index].end : index + 1;
+        }
+
+        /**
+         * @brief The element at index as a view; arrays are materialized without recursion.
+         */
+        [[nodiscard]] RespValueView value(std::size_t index = 0) const;
+
+        /**
+         * @brief The array at index, read in place.
+         *
+         * @pre is_array(index)
+         */
+        [[nodiscard]] ArrayRef array(std::size_t index = 0) const noexcept;
+    };
+
+    /**
+     * @brief Read-only, Array-like access to a request's elements by index.
+     *
+     * Commands receive their arguments through an ArrayRef so they do not care whether the
+     * request sits on a parser Tape (the server path, no allocations) or in an ArrayView
+     * (tests, owning callers). Elements come back as RespValueView by value; for the bulk
+     * strings that make up a request this is just a string_view.
+     *
+     * An ArrayRef does not own anything and must not outlive the tape or view it refers to;
+     * the implicit conversion from ArrayView is meant for passing arguments.
+     *
+     * @example
+     * ```cpp
+     * if (args.size() != 2) { ... }
+     * for (const auto& arg : args) {
+     *     if (!std::holds_alternative<BulkStringView>(arg)) { ... }
+     * }
+     * auto key = std::get<BulkStringView>(args[1]).value;
+     * ```
+     */
+    class ArrayRef {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = RespValueView;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            RespValueView operator*() const;
+            iterator& operator++() noexcept;
+            iterator operator++(int) noexcept {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+            bool operator==(const iterator& other) const noexcept { return position_ == other.position_; }
+
+        private:
+            friend class ArrayRef;
+            iterator(const ArrayRef* array, std::size_t position, std::size_t element) noexcept
+                : array_(array), position_(position), element_(element) {}
+
+            const ArrayRef* array_ = nullptr;
+            std::size_t position_ = 0;
+            /** Tape index of the current element when iterating a tape. */
+            std::size_t element_ = 0;
+        };
+
+        ArrayRef(const ArrayView& array) noexcept : view_(&array) {}
+        ArrayRef(const Tape& tape, std::size_t index) noexcept : tape_(&tape), index_(index) {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return tape_ != nullptr ? tape_->elements[index_].length : view_->values.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+        /**
+         * @pre i < size()
+         */
+        RespValueView operator[](std::size_t i) const;
+
+        [[nodiscard]] iterator begin() const noexcept { return {this, 0, index_ + 1}; }
+        [[nodiscard]] iterator end() const noexcept { return {this, size(), 0}; }
+
+        /**
+         * @brief Copies the elements into an ArrayView (which still views the same bytes).
+         */
+        [[nodiscard]] ArrayView to_view() const;
+
+    private:
+        const ArrayView* view_ = nullptr;
+        const Tape* tape_ = nullptr;
+        std::size_t index_ = 0;
+    };
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <asio.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace gmredis::server {
+
+    /**
+     * @brief A fixed pool of single-threaded asio::io_context event loops.
+     *
+     * Each io_context is driven by exactly one thread, so everything bound to a context
+     * (acceptors, sockets, sessions) runs without cross-thread synchronisation. Contexts are
+     * created with a concurrency hint of 1 which lets asio elide its internal locking.
+     *
+     * @example
+     * ```cpp
+     * IoContextPool pool(4, true);
+     * asio::post(pool.get_io_context(0), [] { ... });
+     * pool.run();   // starts the threads and returns immediately
+     * ...
+     * pool.stop();
+     * pool.join();
+     * ```
+     */
+    class IoContextPool {
+    public:
+        /**
+         * @param pool_size Number of io_contexts/threads; must be at least 1
+         * @param pin_threads Pin thread i to CPU i (modulo CPU count) when the platform allows
+         */
+        explicit IoContextPool(std::size_t pool_size, bool pin_threads = false);
+        ~IoContextPool();
+
+        IoContextPool(const IoContextPool&) = delete;
+        IoContextPool& operator=(const IoContextPool&) = delete;
+
+        /**
+         * @brief Starts one thread per io_context. Does not block.
+         */
+        void run();
+
+        /**
+         * @brief Stops every io_context. Pending handlers are abandoned.
+         */
+        void stop() noexcept;
+
+        /**
+         * @brief Waits for all event-loop threads to exit.
+         */
+        void join();
+
+        [[nodiscard]] std::size_t size() const noexcept { return io_contexts_.size(); }
+
+        /**
+         * @brief Returns the io_context at the given index.
+         */
+        asio::io_context& get_io_context(std::size_t index) { return *io_contexts_.at(index); }
+
+        /**
+         * @brief Returns io_contexts in round-robin order.
+         */
+        asio::io_context& next_io_context() noexcept;
+
+    private:
+        using WorkGuard = asio::executor_work_guard<asio::io_context::executor_type>;
+
+        std::vector<std::unique_ptr<asio::io_context>> io_contexts_;
+        std::vector<WorkGuard> work_guards_;
+        std::vector<std::thread> threads_;
+        std::atomic<std::size_t> next_{0};
+        bool pin_threads_;
+    };
+
+    /**
+     * @brief Pins the calling thread to the given CPU.
+     *
+     * @return true on success, false if pinning failed or is not supported on this platform
+     */
+    bool pin_current_thread(std::size_t cpu) noexcept;
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace gmredis::server {
+
+    /**
+     * @brief Growable per-connection input buffer that accumulates partial RESP frames.
+     *
+     * Layout: `[consumed | readable data | writable tail]`. The socket reads straight into
+     * the writable tail (prepare() + commit()), the parser looks at data() and the session
+     * drops parsed frames with consume(). Nothing is copied per read: the unconsumed bytes are
+     * only moved when the tail is too small for the next read, either by compacting them to
+     * the front or, if the buffer is genuinely too small, by growing it geometrically.
+     *
+     * @example
+     * ```cpp
+     * ReadBuffer buffer;
+     * auto tail = buffer.prepare(4096);
+     * auto n = socket.read_some(asio::buffer(tail.data(), tail.size()));
+     * buffer.commit(n);
+     * auto input = buffer.data();
+     * ...  // parse frames out of input
+     * buffer.consume(bytes_parsed);
+     * ```
+     */
+    class ReadBuffer {
+    public:
+        static constexpr std::size_t default_capacity = 16 * 1024;
+
+        explicit ReadBuffer(std::size_t initial_capacity = default_capacity);
+
+        /**
+         * @brief Returns a writable region of at least min_size bytes at the end of the data.
+         *
+         * May compact or reallocate the buffer, which invalidates views previously returned
+         * by data(). The returned span covers the whole writable tail, which can be larger.
+         */
+        std::span<char> prepare(std::size_t min_size);
+
+        /**
+         * @brief Marks n bytes of the region returned by prepare() as readable.
+         */
+        void commit(std::size_t n) noexcept;
+
+        /**
+         * @brief Drops n bytes from the front of the readable data.
+         */
+        void consume(std::size_t n) noexcept;
+
+        /**
+         * @brief Makes room for size readable bytes in total, allocating exactly that much
+         *        when the buffer is smaller.
+         *
+         * Gives a large frame whose size is known from its header the right buffer up front,
+         * instead of growing (and copying) it geometrically as the bytes arrive. May move the
+         * readable bytes like prepare().
+         */
+        void reserve(std::size_t size);
+
+        /**
+         * @brief Releases storage beyond max(size(), capacity), e.g. once a large frame has
+         *        been consumed.
+         */
+        void shrink(std::size_t capacity);
+
+        /**
+         * @brief The readable (committed but not yet consumed) bytes.
+         */
+        [[nodiscard]] std::string_view data() const noexcept {
+            return {storage_.get() + read_pos_, write_pos_ - read_pos_};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return write_pos_ - read_pos_; }
+        [[nodiscard]] bool empty() const noexcept { return write_pos_ == read_pos_; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        void reallocate(std::size_t capacity);
+
+        std::unique_ptr<char[]> storage_;
+        std::size_t capacity_;
+        std::size_t read_pos_ = 0;
+        std::size_t write_pos_ = 0;
+    };
+
+}
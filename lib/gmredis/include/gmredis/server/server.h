@@ -0,0 +1,104 @@
+#pragma once
+
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/server/io_context_pool.h"
+#include "gmredis/server/server_config.h"
+#include <asio.hpp>
+#include <atomic>
+#include <expected>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace gmredis::server {
+
+    class UringServer;
+
+    /**
+     * @brief Multi-threaded TCP server built on an IoContextPool.
+     *
+     * With ServerConfig::reuse_port enabled every event loop owns an acceptor bound to the same
+     * address with SO_REUSEPORT; the kernel spreads incoming connections across them and a
+     * connection then lives entirely on the loop that accepted it. Without SO_REUSEPORT a single
+     * acceptor distributes accepted sockets round-robin across the pool.
+     *
+     * ServerConfig::backend selects io_uring instead of asio's reactor. If io_uring is not
+     * compiled in or not supported by the kernel, the server logs a warning and uses epoll.
+     *
+     * @example
+     * ```cpp
+     * auto dispatcher = std::make_shared<command::CommandDispatcher>(
+     *     command::make_command_selector(storage::make_store()));
+     * Server server(ServerConfig{.port = 6379, .io_threads = 8}, dispatcher);
+     * if (auto started = server.start(); !started) {
+     *     // handle started.error()
+     * }
+     * server.wait();
+     * ```
+     */
+    class Server {
+    public:
+        /**
+         * @param config Network configuration
+         * @param dispatcher Executes requests; shared by every connection on every thread
+         */
+        Server(ServerConfig config, std::shared_ptr<command::CommandDispatcher> dispatcher);
+        ~Server();
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        /**
+         * @brief Binds the acceptors and starts the event-loop threads. Does not block.
+         *
+         * @return An error code if an acceptor could not be opened, configured or bound
+         */
+        std::expected<void, std::error_code> start();
+
+        /**
+         * @brief Closes the acceptors and stops the event loops. Safe to call from any thread.
+         *
+         * Each acceptor is closed on its own event loop, where it may be mid-accept, and the
+         * loops stop once every acceptor is closed, so the port stops accepting before the
+         * threads exit. Does not block; calls after the first do nothing.
+         */
+        void stop() noexcept;
+
+        /**
+         * @brief Blocks until the event-loop threads have exited (i.e. after stop()).
+         */
+        void wait();
+
+        /**
+         * @brief The port actually bound; differs from the configured port when it was 0.
+         */
+        [[nodiscard]] unsigned short port() const noexcept { return bound_port_; }
+
+        /**
+         * @brief Number of event-loop threads serving connections.
+         */
+        [[nodiscard]] std::size_t io_threads() const noexcept { return pool_.size(); }
+
+        /**
+         * @brief The network backend in use; Epoll if IoUring was requested but is unavailable.
+         */
+        [[nodiscard]] NetworkBackend backend() const noexcept { return backend_; }
+
+    private:
+        bool start_io_uring(const asio::ip::tcp::endpoint& endpoint);
+        std::expected<void, std::error_code> open_acceptor(asio::io_context& io_context,
+                                                           const asio::ip::tcp::endpoint& endpoint);
+        void do_accept(asio::ip::tcp::acceptor& acceptor);
+
+        ServerConfig config_;
+        std::shared_ptr<command::CommandDispatcher> dispatcher_;
+        IoContextPool pool_;
+        std::vector<std::unique_ptr<asio::ip::tcp::acceptor>> acceptors_;
+        std::unique_ptr<UringServer> uring_;
+        unsigned short bound_port_ = 0;
+        bool shared_acceptor_ = false;
+        std::atomic<bool> stopping_{false};
+        NetworkBackend backend_ = NetworkBackend::Epoll;
+    };
+
+}
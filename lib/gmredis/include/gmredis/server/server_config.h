@@ -0,0 +1,103 @@
+#pragma once
+
+#include "gmredis/protocol/limits.h"
+#include "gmredis/storage/kv.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace gmredis::server {
+
+    /**
+     * @brief Event notification mechanism used for network I/O.
+     */
+    enum class NetworkBackend {
+        /** asio's reactor (epoll on Linux, kqueue on macOS). Always available. */
+        Epoll,
+        /**
+         * Native io_uring rings with multishot accept/recv and provided buffer rings. Requires a
+         * build with GMREDIS_ENABLE_IO_URING and Linux 6.0+; otherwise the server falls back to
+         * Epoll at startup.
+         */
+        IoUring,
+    };
+
+    /**
+     * @brief Runtime configuration for the network server.
+     */
+    struct ServerConfig {
+        /** Address the acceptors bind to. */
+        std::string bind_address = "0.0.0.0";
+
+        /** Port to listen on. 0 binds an ephemeral port (see Server::port()). */
+        unsigned short port = 6379;
+
+        /** Number of event-loop threads. 0 selects std::thread::hardware_concurrency(). */
+        std::size_t io_threads = 0;
+
+        /** Pin event-loop thread i to CPU i (modulo the CPU count). Linux only. */
+        bool pin_threads = false;
+
+        /**
+         * Give every event-loop thread its own acceptor bound with SO_REUSEPORT so the
+         * kernel load-balances new connections. When disabled (or unsupported by the
+         * platform) a single acceptor hands connections out round-robin instead.
+         */
+        bool reuse_port = true;
+
+        /**
+         * Maximum number of pipelined requests executed before their replies are flushed.
+         * Bounds the latency of the first reply in a deep pipeline.
+         */
+        std::size_t max_batch_commands = 1024;
+
+        /** Flush the reply batch early once it holds this many bytes. */
+        std::size_t max_batch_bytes = 256 * 1024;
+
+        /** Requested network backend; see Server::backend() for the one actually in use. */
+        NetworkBackend backend = NetworkBackend::Epoll;
+
+        /**
+         * Limits on request sizes. A request beyond them is answered with an error and the
+         * connection is closed.
+         */
+        protocol::ProtocolLimits limits;
+
+        /**
+         * Bulk payloads of at least this many bytes get a read buffer sized exactly for their
+         * frame as soon as the length header arrives, and the buffer is shrunk back once the
+         * frame has been executed.
+         */
+        std::size_t large_bulk_threshold = 32 * 1024;
+
+        /**
+         * Commands running for at least this many microseconds are recorded in the slow log;
+         * negative disables it. Applied when the command set is created, not by the Server.
+         */
+        std::int64_t slowlog_log_slower_than = 10000;
+
+        /** Number of entries the slow log keeps. */
+        std::size_t slowlog_max_len = 128;
+
+        /** Hash table behind the key space. Applied when the store is created, not by the Server. */
+        storage::StoreBackend store_backend = storage::StoreBackend::Unordered;
+
+        /**
+         * Whether a background thread finishes incremental rehashes of the store that writes
+         * have started. Applied when the store is created, not by the Server.
+         */
+        bool active_rehashing = true;
+    };
+
+    /**
+     * @brief Resolves ServerConfig::io_threads to the effective thread count (never 0).
+     */
+    std::size_t effective_io_threads(const ServerConfig& config) noexcept;
+
+    /**
+     * @brief Human readable backend name ("epoll" or "io_uring").
+     */
+    std::string_view to_string(NetworkBackend backend) noexcept;
+
+}
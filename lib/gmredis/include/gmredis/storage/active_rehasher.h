@@ -0,0 +1,50 @@
+#pragma once
+
+#include "gmredis/storage/kv.h"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+namespace gmredis::storage {
+
+    /**
+     * @brief Background thread that keeps incremental rehashes moving, like Redis'
+     *        activerehashing.
+     *
+     * Writes move a few keys of a rehash each, so a store that stops being written to can be
+     * left holding two tables. Every interval this thread calls KVStore::rehash_for() with a
+     * small budget, bounding the time it takes shard locks away from requests.
+     *
+     * @example
+     * ```cpp
+     * std::shared_ptr<KVStore> store = make_store();
+     * ActiveRehasher rehasher(store);  // stopped and joined on destruction
+     * ```
+     */
+    class ActiveRehasher {
+    public:
+        static constexpr std::chrono::milliseconds default_interval{100};
+        static constexpr std::chrono::microseconds default_budget{1000};
+
+        explicit ActiveRehasher(std::shared_ptr<KVStore> store, std::chrono::milliseconds interval = default_interval,
+                                std::chrono::microseconds budget = default_budget);
+
+        ActiveRehasher(const ActiveRehasher&) = delete;
+        ActiveRehasher& operator=(const ActiveRehasher&) = delete;
+
+    private:
+        void run(const std::stop_token& stop);
+
+        std::shared_ptr<KVStore> store_;
+        std::chrono::milliseconds interval_;
+        std::chrono::microseconds budget_;
+        std::mutex mutex_;
+        std::condition_variable_any wakeup_;
+        /** Last, so it stops before the members it uses are destroyed. */
+        std::jthread thread_;
+    };
+
+}
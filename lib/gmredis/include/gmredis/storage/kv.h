@@ -1,9 +1,14 @@
 #ifndef GMREDIS_KV_H
 #define GMREDIS_KV_H
 
+#include <chrono>
+#include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <expected>
+#include <memory>
+#include <utility>
 
 namespace gmredis::storage {
 
@@ -19,14 +24,98 @@ namespace gmredis::storage {
         std::string message;
     };
 
+    /**
+     * @brief A value handed to a KVStore::read() reader.
+     */
+    struct ValueView {
+        /** Valid only during the call. */
+        std::string_view bytes;
+        /**
+         * The immutable buffer holding bytes, which the reader may keep past the call, or
+         * null when the store keeps the value inline.
+         */
+        const std::shared_ptr<const std::string>* shared = nullptr;
+    };
+
     class KVStore {
     public:
 
         virtual ~KVStore() = default;
-        virtual std::expected<void, ErrorInfo> put(const std::string &key, const std::string &value) = 0;
-        virtual std::expected<std::string, ErrorInfo> get(const std::string &key) = 0;
-        virtual std::expected<int, ErrorInfo> del(const std::string &key) = 0;
+
+        /**
+         * @brief Stores a copy of value under key. Keys are taken as views so that commands
+         *        can pass slices of the request buffer; only a new key is copied.
+         */
+        virtual std::expected<void, ErrorInfo> put(std::string_view key, std::string_view value) = 0;
+
+        /**
+         * @brief put() for buffers the caller already owns: a store moves them into the entry
+         *        instead of copying. The default copies.
+         *
+         * Not an overload of put(), which would make put("key", "value") ambiguous.
+         */
+        virtual std::expected<void, ErrorInfo> put_owned(std::string &&key, std::string &&value) {
+            return put(key, value);
+        }
+
+        virtual std::expected<std::string, ErrorInfo> get(std::string_view key) = 0;
+
+        /**
+         * @brief Calls reader with the value of key without copying it out, so a reply can
+         *        reference a large value instead of encoding a copy.
+         *
+         * The reader runs under whatever lock protects the value: it must be quick and must
+         * not call back into the store. The default copies the value out through get().
+         *
+         * @return The get() error, with no call, when key cannot be read
+         */
+        virtual std::expected<void, ErrorInfo> read(std::string_view key, const std::function<void(const ValueView &)> &reader) {
+            auto value = get(key);
+            if (!value.has_value()) {
+                return std::unexpected(std::move(value.error()));
+            }
+            reader(ValueView{.bytes = *value});
+            return {};
+        }
+
+        virtual std::expected<int, ErrorInfo> del(std::string_view key) = 0;
+
+        /**
+         * @brief Spends up to budget moving keys of an unfinished incremental rehash.
+         *
+         * Called periodically off the request path (see ActiveRehasher) so a rehash started by
+         * a write also finishes when writes stop. Stores that resize in one step keep this
+         * default.
+         *
+         * @return Whether a rehash is still in progress
+         */
+        virtual bool rehash_for([[maybe_unused]] std::chrono::microseconds budget) { return false; }
+    };
+
+    /**
+     * @brief Hash table behind each shard of the server's store.
+     *
+     * Both keep each key and its value as one packed block: varint length headers, then the
+     * key and, below 2 KiB, the value; larger values live in a shared buffer that GET replies
+     * reference instead of copying.
+     */
+    enum class StoreBackend {
+        /** std::unordered_set of packed entries, one node with a cached hash per key, rehashed incrementally. */
+        Unordered,
+        /** Open-addressing table with SIMD-probed control bytes, one packed-entry pointer per slot. */
+        Flat,
     };
+
+    /**
+     * Creates the store used by the server: an in-memory store that is safe to share between
+     * threads, split into independently locked shards.
+     */
+    std::unique_ptr<KVStore> make_store(StoreBackend backend = StoreBackend::Unordered);
+
+    /**
+     * @brief Human readable backend name ("unordered" or "flat").
+     */
+    std::string_view to_string(StoreBackend backend) noexcept;
 }
 
 #endif //GMREDIS_KV_H
\ No newline at end of file
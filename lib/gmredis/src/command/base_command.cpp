@@ -1,25 +1,103 @@
 #include "gmredis/command/base_command.h"
+#include "gmredis/protocol/parse.h"
+#include <string>
 
 namespace gmredis::command {
 
-    std::optional<CommandError> BaseCommand::validate(const protocol::Array& arg) {
+    std::optional<CommandError> BaseCommand::validate(const protocol::ArrayRef& arg) {
         preValidate(arg);
 
         auto validationResult = doValidate(arg);
 
         postValidate(arg);
 
+        if (validationResult.has_value() && stats_ != nullptr) {
+            stats_->record_rejected(type_);
+        }
+
         return validationResult;
     }
 
-    std::expected<protocol::RespValue, CommandError> BaseCommand::execute(const protocol::Array& arg) {
+    std::expected<protocol::RespValue, CommandError> BaseCommand::execute(const protocol::ArrayRef& arg) {
+        auto const start = startExecution();
+
         preExecute(arg);
 
         auto executionResult = doExecute(arg);
 
         postExecute(arg, executionResult);
 
+        recordExecution(arg, start, !executionResult.has_value());
+
         return executionResult;
     }
 
-}
\ No newline at end of file
+    std::optional<CommandError> BaseCommand::executeInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        auto const start = startExecution();
+
+        preExecute(arg);
+
+        auto executionError = doExecuteInto(arg, sink);
+
+        recordExecution(arg, start, executionError.has_value());
+
+        return executionError;
+    }
+
+    std::optional<CommandError> BaseCommand::doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        auto executionResult = doExecute(arg);
+
+        postExecute(arg, executionResult);
+
+        if (!executionResult.has_value()) {
+            return std::move(executionResult.error());
+        }
+        sink.write(executionResult.value());
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> BaseCommand::materialize(const protocol::ArrayRef& arg) {
+        std::string encoded;
+        protocol::ReplySink sink(encoded);
+        if (auto error = doExecuteInto(arg, sink); error.has_value()) {
+            return std::unexpected(std::move(error.value()));
+        }
+
+        std::string_view input = encoded;
+        auto value = protocol::parse(input);
+        if (!value.has_value()) {
+            return std::unexpected(CommandError(CommandErrorCode::ExecutionFailed, "reply could not be decoded"));
+        }
+        return std::move(value.value());
+    }
+
+    std::chrono::steady_clock::time_point BaseCommand::startExecution() const noexcept {
+        // Without stats or a slow log this costs nothing but the branch: no clock reads
+        return stats_ != nullptr || slowlog_ != nullptr ? std::chrono::steady_clock::now()
+                                                        : std::chrono::steady_clock::time_point{};
+    }
+
+    void BaseCommand::recordExecution(const protocol::ArrayRef& arg, std::chrono::steady_clock::time_point start, bool failed) {
+        if (stats_ == nullptr && slowlog_ == nullptr) {
+            return;
+        }
+
+        auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        if (stats_ != nullptr) {
+            stats_->record_call(type_, static_cast<std::uint64_t>(elapsed.count()), failed);
+        }
+        if (slowlog_ != nullptr && slowlog_->is_slow(elapsed)) {
+            slowlog_->record(arg, elapsed);
+        }
+    }
+
+    void BaseCommand::enableStats(CommandType type, std::shared_ptr<Stats> stats) noexcept {
+        type_ = type;
+        stats_ = std::move(stats);
+    }
+
+    void BaseCommand::enableSlowLog(std::shared_ptr<SlowLog> slowlog) noexcept {
+        slowlog_ = std::move(slowlog);
+    }
+
+}
@@ -1,17 +1,23 @@
 #include "gmredis/command/command.h"
+#include "gmredis/command/command_spec.h"
+#include "command_lookup.h"
 
 namespace gmredis::command {
-    std::optional<CommandType> get_command(std::string_view command) {
-        if (command.empty()) {
-            return std::nullopt;
-        }
+    namespace {
+        constexpr detail::CommandLookup<command_specs.size()> command_lookup{command_specs};
+    }
 
-        auto it = command_table.find(command);
-        if (it != command_table.end()) {
-            return it->second;
-        }
+    std::optional<CommandType> get_command(std::string_view command) noexcept {
+        return command_lookup.find(command);
+    }
 
+    std::optional<CommandError> Command::executeInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        auto result = execute(arg);
+        if (!result.has_value()) {
+            return std::move(result.error());
+        }
+        sink.write(result.value());
         return std::nullopt;
     }
 
-}
\ No newline at end of file
+}
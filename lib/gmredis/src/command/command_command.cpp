@@ -0,0 +1,104 @@
+#include "gmredis/command/command_command.h"
+#include "gmredis/command/command_spec.h"
+#include "gmredis/protocol/shared_replies.h"
+#include "command_lookup.h"
+#include <algorithm>
+
+namespace gmredis::command {
+    constexpr size_t SUBCOMMAND_INDEX = 1;
+    constexpr size_t FIRST_NAME_INDEX = 2;
+
+    namespace {
+        void describe(protocol::ReplySink& sink, const CommandSpec& spec) {
+            sink.begin_array(10);
+            sink.bulk(spec.name);
+            sink.integer(spec.arity);
+
+            auto const flag_count = static_cast<std::size_t>(has_flag(spec.flags, CommandFlag::Write)) +
+                                    static_cast<std::size_t>(has_flag(spec.flags, CommandFlag::ReadOnly)) +
+                                    static_cast<std::size_t>(has_flag(spec.flags, CommandFlag::Fast));
+            sink.begin_array(flag_count);
+            if (has_flag(spec.flags, CommandFlag::Write)) {
+                sink.simple_string("write");
+            }
+            if (has_flag(spec.flags, CommandFlag::ReadOnly)) {
+                sink.simple_string("readonly");
+            }
+            if (has_flag(spec.flags, CommandFlag::Fast)) {
+                sink.simple_string("fast");
+            }
+
+            sink.integer(spec.first_key);
+            sink.integer(spec.last_key);
+            sink.integer(spec.key_step);
+            // ACL categories, tips, key specifications, subcommands
+            for (int i = 0; i < 4; i++) {
+                sink.write(protocol::shared::empty_array);
+            }
+        }
+    }
+
+    CommandCommand::CommandCommand() {
+        protocol::ReplySink sink(all_commands_);
+        sink.begin_array(command_specs.size());
+        for (const auto& spec : command_specs) {
+            describe(sink, spec);
+        }
+    }
+
+    std::optional<CommandError> CommandCommand::doValidate(const protocol::ArrayRef& arg) {
+        if (arg.size() <= SUBCOMMAND_INDEX) {
+            return std::nullopt;
+        }
+
+        auto const subcommand = std::get<protocol::BulkStringView>(arg[SUBCOMMAND_INDEX]).value;
+        if (detail::equals_ignore_case(subcommand, "count") && arg.size() != FIRST_NAME_INDEX) {
+            return CommandError(CommandErrorCode::WrongArgumentCount, "wrong number of arguments for 'command|count' command");
+        }
+        if (!detail::equals_ignore_case(subcommand, "count") && !detail::equals_ignore_case(subcommand, "info") &&
+            !detail::equals_ignore_case(subcommand, "docs")) {
+            return CommandError(CommandErrorCode::InvalidArgument,
+                                "unknown subcommand '" + std::string(subcommand) + "'. Try COMMAND HELP.");
+        }
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> CommandCommand::doExecute(const protocol::ArrayRef& arg) {
+        return materialize(arg);
+    }
+
+    std::optional<CommandError> CommandCommand::doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        if (arg.size() <= SUBCOMMAND_INDEX) {
+            sink.write(protocol::EncodedReply{all_commands_});
+            return std::nullopt;
+        }
+
+        auto const subcommand = std::get<protocol::BulkStringView>(arg[SUBCOMMAND_INDEX]).value;
+        if (detail::equals_ignore_case(subcommand, "count")) {
+            sink.integer(static_cast<std::int64_t>(command_specs.size()));
+            return std::nullopt;
+        }
+        if (detail::equals_ignore_case(subcommand, "docs")) {
+            sink.write(protocol::shared::empty_array);
+            return std::nullopt;
+        }
+
+        // INFO
+        if (arg.size() == FIRST_NAME_INDEX) {
+            sink.write(protocol::EncodedReply{all_commands_});
+            return std::nullopt;
+        }
+
+        sink.begin_array(arg.size() - FIRST_NAME_INDEX);
+        for (auto i = FIRST_NAME_INDEX; i < arg.size(); i++) {
+            auto const type = get_command(std::get<protocol::BulkStringView>(arg[i]).value);
+            if (type.has_value()) {
+                describe(sink, command_spec(type.value()));
+            } else {
+                sink.null();
+            }
+        }
+        return std::nullopt;
+    }
+
+}
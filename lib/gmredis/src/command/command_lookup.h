@@ -0,0 +1,177 @@
+#pragma once
+
+#include "gmredis/command/command.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace gmredis::command::detail {
+
+    /** Longest command name the lookup can hold: two 64-bit words. */
+    inline constexpr std::size_t max_name_length = 16;
+
+    /**
+     * @brief ASCII lower-cases the eight bytes of word at once.
+     *
+     * Only 'A'..'Z' are changed; every other byte, including non-ASCII ones, is left as is,
+     * so folding never makes two different names equal.
+     */
+    constexpr std::uint64_t fold_case(std::uint64_t word) noexcept {
+        constexpr std::uint64_t ones = 0x0101010101010101ULL;
+        constexpr std::uint64_t high_bits = ones * 0x80;
+
+        // Adding to the low seven bits of a byte cannot carry into the next byte, and sets
+        // its high bit exactly when the byte is >= 'A' (resp. > 'Z').
+        const auto low_bits = word & ~high_bits;
+        const auto at_least_a = low_bits + ones * (0x80 - 'A');
+        const auto above_z = low_bits + ones * (0x80 - 'Z' - 1);
+        const auto upper = (at_least_a ^ above_z) & ~word & high_bits;
+        return word | (upper >> 2);
+    }
+
+    /**
+     * @brief A name of up to max_name_length bytes, zero padded and case folded.
+     */
+    struct NameKey {
+        std::uint64_t low = 0;
+        std::uint64_t high = 0;
+        std::uint64_t length = 0;
+
+        bool operator==(const NameKey&) const = default;
+    };
+
+    /**
+     * @pre name.size() <= max_name_length
+     */
+    constexpr NameKey make_key(std::string_view name) noexcept {
+        std::array<char, max_name_length> bytes{};
+        if consteval {
+            std::ranges::copy(name, bytes.begin());
+        } else {
+            std::memcpy(bytes.data(), name.data(), name.size());
+        }
+        const auto words = std::bit_cast<std::array<std::uint64_t, 2>>(bytes);
+        return {fold_case(words[0]), fold_case(words[1]), name.size()};
+    }
+
+    /**
+     * @brief ASCII case-insensitive comparison, for subcommand and section names.
+     */
+    inline bool equals_ignore_case(std::string_view a, std::string_view b) noexcept {
+        return std::ranges::equal(a, b, [](char x, char y) {
+            return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+        });
+    }
+
+    constexpr std::size_t hash_key(const NameKey& key, std::uint64_t seed, std::size_t bits) noexcept {
+        const auto mixed = (key.low ^ std::rotl(key.high, 29) ^ key.length) * seed;
+        return static_cast<std::size_t>(mixed >> (64 - bits));
+    }
+
+    /**
+     * @brief Case-insensitive name to CommandType lookup through a perfect hash built at
+     *        compile time.
+     *
+     * The constructor searches for a multiplier that sends every name to its own slot, so
+     * find() is one case fold, one multiply and a single compare of the folded words: no
+     * loops over characters, no probing and no branches that depend on the name.
+     *
+     * @example
+     * ```cpp
+     * constexpr std::array<CommandName, 2> names{{{"get", CommandType::Get}, {"set", CommandType::Set}}};
+     * constexpr CommandLookup<2> lookup{names};
+     * lookup.find("GET");  // CommandType::Get
+     * ```
+     */
+    template <std::size_t N>
+    class CommandLookup {
+        static_assert(N > 0 && N < 255, "the slot index is one byte");
+
+    public:
+        /**
+         * @param names Entries with a lower-case `name` and a `type`, e.g. CommandName or
+         *              CommandSpec
+         */
+        template <typename Named>
+        consteval explicit CommandLookup(const std::array<Named, N>& names) {
+            for (std::size_t i = 0; i < N; i++) {
+                const auto name = names[i].name;
+                if (name.empty() || name.size() > max_name_length) {
+                    throw "command names must be 1 to max_name_length bytes";
+                }
+                if (std::ranges::any_of(name, [](char c) { return c >= 'A' && c <= 'Z'; })) {
+                    throw "command names must be lower case";
+                }
+                entries_[i + 1] = {make_key(name), names[i].type};
+            }
+
+            // Neighbouring multipliers hash almost identically, so candidates come from a
+            // splitmix64 sequence instead
+            for (std::uint64_t state = 0;;) {
+                state += 0x9E3779B97F4A7C15ULL;
+                auto candidate = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                candidate = (candidate ^ (candidate >> 27)) * 0x94D049BB133111EBULL;
+                if (try_seed((candidate ^ (candidate >> 31)) | 1)) {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * @brief The command named name, ignoring ASCII case.
+         */
+        [[nodiscard]] std::optional<CommandType> find(std::string_view name) const noexcept {
+            // Also rejects the empty name: size() - 1 wraps around
+            if (name.size() - 1 >= max_name_length) {
+                return std::nullopt;
+            }
+
+            const auto key = make_key(name);
+            // Empty slots point at entries_[0], whose zero length matches no name
+            const auto& entry = entries_[slots_[hash_key(key, seed_, bits)]];
+            const auto difference = (entry.key.low ^ key.low) | (entry.key.high ^ key.high) |
+                                    (entry.key.length ^ key.length);
+            if (difference != 0) {
+                return std::nullopt;
+            }
+            return entry.type;
+        }
+
+    private:
+        /** At least four slots per name keeps the seed search short. */
+        static constexpr std::size_t bits = static_cast<std::size_t>(std::bit_width(N)) + 2;
+
+        struct Entry {
+            NameKey key;
+            CommandType type{};
+        };
+
+        consteval bool try_seed(std::uint64_t candidate) {
+            std::array<std::uint8_t, std::size_t{1} << bits> slots{};
+            for (std::size_t i = 1; i <= N; i++) {
+                auto& slot = slots[hash_key(entries_[i].key, candidate, bits)];
+                if (slot != 0) {
+                    if (entries_[slot].key == entries_[i].key) {
+                        throw "duplicate command name";
+                    }
+                    return false;
+                }
+                slot = static_cast<std::uint8_t>(i);
+            }
+            seed_ = candidate;
+            slots_ = slots;
+            return true;
+        }
+
+        std::uint64_t seed_ = 0;
+        std::array<std::uint8_t, std::size_t{1} << bits> slots_{};
+        std::array<Entry, N + 1> entries_{};
+    };
+
+}
@@ -7,20 +7,27 @@ namespace gmredis::command {
             return CommandRegistryError::NullCommand;
         }
 
-        if (commands.contains(commandType)) {
+        auto const index = static_cast<std::size_t>(commandType);
+        if (index >= commands.size()) {
+            return CommandRegistryError::CommandNotFound;
+        }
+
+        auto& slot = commands[index];
+        if (slot != nullptr) {
             return CommandRegistryError::AlreadyRegistered;
         }
 
-        commands.insert({commandType, command});
+        slot = std::move(command);
 
         return std::nullopt;
     }
 
-    std::expected<std::shared_ptr<Command>, CommandRegistryError> DefaultCommandRegistry::getCommand(CommandType commandType) const noexcept {
-        if (!commands.contains(commandType)) {
+    std::expected<std::reference_wrapper<Command>, CommandRegistryError> DefaultCommandRegistry::getCommand(CommandType commandType) const noexcept {
+        auto const index = static_cast<std::size_t>(commandType);
+        if (index >= commands.size() || commands[index] == nullptr) {
             return std::unexpected(CommandRegistryError::CommandNotFound);
         }
-        return commands.at(commandType);
+        return *commands[index];
     }
 
-}
\ No newline at end of file
+}
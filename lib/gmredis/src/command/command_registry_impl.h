@@ -1,14 +1,20 @@
 #pragma once
 
 #include "gmredis/command/command_registry.h"
-#include <unordered_map>
+#include <array>
 
 namespace gmredis::command {
+    /**
+     * @brief CommandRegistry backed by a table indexed by CommandType.
+     *
+     * getCommand() is a bounds check and an array load: no hashing, and since the table owns
+     * the commands and hands out references, no atomic reference count traffic either.
+     */
     class DefaultCommandRegistry : public CommandRegistry {
     public:
         std::optional<CommandRegistryError> registerCommand(CommandType commandType, std::shared_ptr<Command> command) noexcept override;
-        std::expected<std::shared_ptr<Command>, CommandRegistryError> getCommand(CommandType commandType) const noexcept override;
+        std::expected<std::reference_wrapper<Command>, CommandRegistryError> getCommand(CommandType commandType) const noexcept override;
     private:
-        std::unordered_map<CommandType, std::shared_ptr<Command>> commands;
+        std::array<std::shared_ptr<Command>, command_type_count> commands;
     };
 }
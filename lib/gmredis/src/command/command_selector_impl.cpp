@@ -1,33 +1,38 @@
 #include "command_selector_impl.h"
+#include "gmredis/command/command_spec.h"
 
 namespace gmredis::command {
     constexpr size_t COMMAND_INDEX = 0;
 
-    std::expected<std::shared_ptr<Command>, CommandError> DefaultCommandSelector::select(const protocol::Array& req) {
-        if (req.values.size() == 0) {
+    std::expected<std::reference_wrapper<Command>, CommandError> DefaultCommandSelector::select(const protocol::ArrayRef& req) {
+        if (req.empty()) {
             return std::unexpected(CommandError(CommandErrorCode::WrongArgumentCount, "Cannot select an empty array."));
         }
 
-        for (const auto& val : req.values) {
-            if (!std::holds_alternative<protocol::BulkString>(val)) {
-                return std::unexpected(CommandError(CommandErrorCode::InvalidArgument, "All arguments must be BulkStrings"));
-            }
+        auto const name = req[COMMAND_INDEX];
+        if (!std::holds_alternative<protocol::BulkStringView>(name)) {
+            return std::unexpected(CommandError(CommandErrorCode::InvalidArgument, "All arguments must be BulkStrings"));
         }
 
-        auto commandText = std::get<protocol::BulkString>(req.values[COMMAND_INDEX]).value;
-
         //Convert the text to a CommandType
-        auto commandType = get_command(commandText);
+        auto commandType = get_command(std::get<protocol::BulkStringView>(name).value);
         if (!commandType.has_value()) {
             return std::unexpected(CommandError(CommandErrorCode::CommandNotFound, "command text is not valid"));
         }
 
+        // The one validation pass over the arguments; commands only check what the spec can't express
+        if (auto invalid = check_arguments(command_spec(commandType.value()), req); invalid.has_value()) {
+            if (stats != nullptr) {
+                stats->record_rejected(commandType.value());
+            }
+            return std::unexpected(std::move(invalid.value()));
+        }
+
         auto cmd = command_registry->getCommand(commandType.value());
         if (!cmd.has_value()) {
             return std::unexpected(CommandError(CommandErrorCode::CommandNotFound, "command not registered in command registry"));
         }
 
         return cmd.value();
-
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "gmredis/command/command_selector.h"
 #include "gmredis/command/command_registry.h"
+#include "gmredis/command/stats.h"
 #include <memory>
 
 namespace gmredis::command {
@@ -24,18 +25,24 @@ namespace gmredis::command {
          * @param command_registry Unique pointer to the CommandRegistry that will be used
          *                        to look up and instantiate commands. Ownership is transferred
          *                        to this CommandSelector instance.
+         * @param stats Where requests refused by the spec check are counted; optional
          */
-        explicit DefaultCommandSelector(std::unique_ptr<CommandRegistry> command_registry) : command_registry(std::move(command_registry)) {}
+        explicit DefaultCommandSelector(std::unique_ptr<CommandRegistry> command_registry, std::shared_ptr<Stats> stats = nullptr)
+            : command_registry(std::move(command_registry)), stats(std::move(stats)) {}
 
         /**
          * @brief Selects a command by querying the registry with the command name from the request.
          *
+         * The request is checked against the command's CommandSpec (argument types and arity)
+         * before the command is looked up.
+         *
          * @param req The RESP protocol array containing the command name and arguments.
          * @return std::expected containing either the selected Command or a CommandError.
          */
-        std::expected<std::shared_ptr<Command>, CommandError> select(const protocol::Array& req) override;
+        std::expected<std::reference_wrapper<Command>, CommandError> select(const protocol::ArrayRef& req) override;
     private:
         std::unique_ptr<CommandRegistry> command_registry; ///< Registry used for command lookup.
+        std::shared_ptr<Stats> stats; ///< Rejected call counters; may be null.
 
     };
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "gmredis/command/command_spec.h"
+#include <algorithm>
+#include <string>
+
+namespace gmredis::command {
+    namespace {
+        constexpr auto make_spec_table() {
+            std::array<const CommandSpec*, command_type_count> table{};
+            for (const auto& spec : command_specs) {
+                table[static_cast<std::size_t>(spec.type)] = &spec;
+            }
+            return table;
+        }
+
+        constexpr auto spec_table = make_spec_table();
+
+        static_assert(std::ranges::none_of(spec_table, [](const CommandSpec* spec) { return spec == nullptr; }),
+                      "every CommandType needs a spec");
+    }
+
+    const CommandSpec& command_spec(CommandType type) noexcept {
+        return *spec_table[static_cast<std::size_t>(type)];
+    }
+
+    KeyRange key_range(const CommandSpec& spec, std::size_t argc) noexcept {
+        if (spec.first_key <= 0 || static_cast<std::size_t>(spec.first_key) >= argc) {
+            return {};
+        }
+
+        auto const last = spec.last_key < 0
+            ? static_cast<std::ptrdiff_t>(argc) + spec.last_key
+            : static_cast<std::ptrdiff_t>(spec.last_key);
+        return KeyRange{
+            .first = static_cast<std::size_t>(spec.first_key),
+            .last = static_cast<std::size_t>(std::max<std::ptrdiff_t>(last, spec.first_key)),
+            .step = static_cast<std::size_t>(spec.key_step),
+        };
+    }
+
+    std::optional<CommandError> check_arguments(const CommandSpec& spec, const protocol::ArrayRef& args) {
+        for (const auto& val : args) {
+            if (!std::holds_alternative<protocol::BulkStringView>(val)) {
+                return CommandError(CommandErrorCode::InvalidArgument, "All arguments must be BulkStrings");
+            }
+        }
+
+        auto const argc = static_cast<std::ptrdiff_t>(args.size());
+        auto const arity = static_cast<std::ptrdiff_t>(spec.arity);
+        if (arity >= 0 ? argc != arity : argc < -arity) {
+            return CommandError(CommandErrorCode::WrongArgumentCount,
+                                "wrong number of arguments for '" + std::string(spec.name) + "' command");
+        }
+
+        return std::nullopt;
+    }
+
+}
@@ -0,0 +1,87 @@
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/command/command_command.h"
+#include "gmredis/command/get.h"
+#include "gmredis/command/info.h"
+#include "gmredis/command/latency.h"
+#include "gmredis/command/ping.h"
+#include "gmredis/command/set.h"
+#include "gmredis/command/slowlog_command.h"
+#include "command_registry_impl.h"
+#include "command_selector_impl.h"
+#include <utility>
+
+namespace gmredis::command {
+
+    protocol::RespValue CommandDispatcher::dispatch(const protocol::ArrayRef& request) {
+        auto command = selector_->select(request);
+        if (!command.has_value()) {
+            return to_error_reply(command.error());
+        }
+
+        Command& cmd = command.value();
+        if (auto invalid = cmd.validate(request); invalid.has_value()) {
+            return to_error_reply(invalid.value());
+        }
+
+        auto result = cmd.execute(request);
+        if (!result.has_value()) {
+            return to_error_reply(result.error());
+        }
+
+        return *std::move(result);
+    }
+
+    void CommandDispatcher::dispatch(const protocol::ArrayRef& request, protocol::ReplySink& sink) {
+        auto command = selector_->select(request);
+        if (!command.has_value()) {
+            sink.write(to_error_reply(command.error()));
+            return;
+        }
+
+        Command& cmd = command.value();
+        if (auto invalid = cmd.validate(request); invalid.has_value()) {
+            sink.write(to_error_reply(invalid.value()));
+            return;
+        }
+
+        auto const mark = sink.mark();
+        if (auto failed = cmd.executeInto(request, sink); failed.has_value()) {
+            sink.rewind(mark);
+            sink.write(to_error_reply(failed.value()));
+        }
+    }
+
+    protocol::RespValue CommandDispatcher::dispatch(const protocol::Array& request) {
+        auto const view = protocol::to_view(request);
+        return dispatch(view);
+    }
+
+    protocol::SimpleError to_error_reply(const CommandError& error) {
+        return protocol::SimpleError{.value = "ERR " + error.message};
+    }
+
+    std::shared_ptr<CommandSelector> make_command_selector(std::shared_ptr<storage::KVStore> store, std::shared_ptr<Stats> stats,
+                                                           std::shared_ptr<SlowLog> slowlog) {
+        std::pair<CommandType, std::shared_ptr<BaseCommand>> commands[] = {
+            {CommandType::Ping, std::make_shared<PingCommand>()},
+            {CommandType::Get, std::make_shared<GetCommand>(store)},
+            {CommandType::Set, std::make_shared<SetCommand>(store)},
+            {CommandType::Command, std::make_shared<CommandCommand>()},
+            {CommandType::Info, std::make_shared<InfoCommand>(stats)},
+            {CommandType::Latency, std::make_shared<LatencyCommand>(stats)},
+            {CommandType::Slowlog, std::make_shared<SlowLogCommand>(slowlog)},
+        };
+
+        auto registry = std::make_unique<DefaultCommandRegistry>();
+        for (auto& [type, command] : commands) {
+            if (stats != nullptr) {
+                command->enableStats(type, stats);
+            }
+            if (slowlog != nullptr) {
+                command->enableSlowLog(slowlog);
+            }
+            registry->registerCommand(type, std::move(command));
+        }
+        return std::make_shared<DefaultCommandSelector>(std::move(registry), std::move(stats));
+    }
+}
@@ -0,0 +1,46 @@
+#include "gmredis/command/get.h"
+
+namespace gmredis::command {
+    constexpr size_t KEY_INDEX = 1;
+
+    std::optional<CommandError> GetCommand::doValidate([[maybe_unused]] const protocol::ArrayRef& arg) {
+        // Arity and argument types are checked against the spec
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> GetCommand::doExecute(const protocol::ArrayRef& arg) {
+        auto const key = std::get<protocol::BulkStringView>(arg[KEY_INDEX]).value;
+
+        auto result = store_->get(key);
+        if (!result.has_value()) {
+            if (result.error().code == storage::KVError::KeyNotFound) {
+                return protocol::Null{};
+            }
+            return std::unexpected(CommandError(CommandErrorCode::ExecutionFailed, result.error().message));
+        }
+
+        auto length = result->size();
+        return protocol::BulkString{.value = std::move(*result), .length = length};
+    }
+
+    std::optional<CommandError> GetCommand::doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        auto const key = std::get<protocol::BulkStringView>(arg[KEY_INDEX]).value;
+
+        auto result = store_->read(key, [&sink](const storage::ValueView& value) {
+            if (value.shared != nullptr) {
+                sink.bulk(*value.shared);
+            } else {
+                sink.bulk(value.bytes);
+            }
+        });
+        if (!result.has_value()) {
+            if (result.error().code == storage::KVError::KeyNotFound) {
+                sink.null();
+                return std::nullopt;
+            }
+            return CommandError(CommandErrorCode::ExecutionFailed, result.error().message);
+        }
+        return std::nullopt;
+    }
+
+}
@@ -0,0 +1,123 @@
+#include "gmredis/command/info.h"
+#include "gmredis/command/command_spec.h"
+#include "command_lookup.h"
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <string>
+
+namespace gmredis::command {
+    constexpr size_t FIRST_SECTION_INDEX = 1;
+
+    namespace {
+        /** Bits of the requested sections. */
+        constexpr unsigned StatsSection = 1U << 0;
+        constexpr unsigned CommandStatsSection = 1U << 1;
+        constexpr unsigned LatencyStatsSection = 1U << 2;
+        constexpr unsigned AllSections = StatsSection | CommandStatsSection | LatencyStatsSection;
+
+        unsigned section_of(std::string_view name) {
+            if (detail::equals_ignore_case(name, "stats")) {
+                return StatsSection;
+            }
+            if (detail::equals_ignore_case(name, "commandstats")) {
+                return CommandStatsSection;
+            }
+            if (detail::equals_ignore_case(name, "latencystats")) {
+                return LatencyStatsSection;
+            }
+            if (detail::equals_ignore_case(name, "all") || detail::equals_ignore_case(name, "everything") ||
+                detail::equals_ignore_case(name, "default")) {
+                return AllSections;
+            }
+            return 0;
+        }
+
+        void write_stats(std::string& out, const StatsSnapshot& snapshot, double ops_per_sec) {
+            std::format_to(std::back_inserter(out),
+                           "# Stats\r\n"
+                           "total_connections_received:{}\r\n"
+                           "total_commands_processed:{}\r\n"
+                           "instantaneous_ops_per_sec:{}\r\n"
+                           "total_net_input_bytes:{}\r\n"
+                           "total_net_output_bytes:{}\r\n",
+                           snapshot.connections_received, snapshot.total_commands_processed(),
+                           static_cast<std::uint64_t>(ops_per_sec), snapshot.net_input_bytes,
+                           snapshot.net_output_bytes);
+        }
+
+        void write_command_stats(std::string& out, const StatsSnapshot& snapshot) {
+            out += "# Commandstats\r\n";
+            for (const auto& spec : command_specs) {
+                const auto& counters = snapshot.commands[static_cast<std::size_t>(spec.type)];
+                if (counters.calls == 0 && counters.rejected_calls == 0) {
+                    continue;
+                }
+                auto const usec = counters.nanoseconds / 1000;
+                auto const per_call = counters.calls == 0 ? 0.0 : static_cast<double>(counters.nanoseconds) / 1000.0 / static_cast<double>(counters.calls);
+                std::format_to(std::back_inserter(out),
+                               "cmdstat_{}:calls={},usec={},usec_per_call={:.2f},rejected_calls={},failed_calls={}\r\n",
+                               spec.name, counters.calls, usec, per_call, counters.rejected_calls,
+                               counters.failed_calls);
+            }
+        }
+
+        void write_percentiles(std::string& out, const HistogramSnapshot& histogram) {
+            auto usec = [&histogram](double percentile) {
+                return static_cast<double>(histogram.value_at_percentile(percentile)) / 1000.0;
+            };
+            std::format_to(std::back_inserter(out), "p50={:.3f},p99={:.3f},p99.9={:.3f}\r\n", usec(50.0), usec(99.0),
+                           usec(99.9));
+        }
+
+        void write_latency_stats(std::string& out, const LatencySnapshot& snapshot) {
+            out += "# Latencystats\r\n";
+            for (const auto& spec : command_specs) {
+                const auto& histogram = snapshot.commands[static_cast<std::size_t>(spec.type)];
+                if (histogram.total() == 0) {
+                    continue;
+                }
+                std::format_to(std::back_inserter(out), "latency_percentiles_usec_{}:", spec.name);
+                write_percentiles(out, histogram);
+            }
+            if (snapshot.requests.total() != 0) {
+                out += "request_latency_percentiles_usec:";
+                write_percentiles(out, snapshot.requests);
+            }
+        }
+    }
+
+    std::optional<CommandError> InfoCommand::doValidate([[maybe_unused]] const protocol::ArrayRef& arg) {
+        // Any number of section names; unknown ones are ignored, as in Redis
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> InfoCommand::doExecute(const protocol::ArrayRef& arg) {
+        unsigned sections = arg.size() > FIRST_SECTION_INDEX ? 0U : AllSections;
+        for (auto i = FIRST_SECTION_INDEX; i < arg.size(); i++) {
+            sections |= section_of(std::get<protocol::BulkStringView>(arg[i]).value);
+        }
+
+        auto const snapshot = stats_ != nullptr ? stats_->snapshot() : StatsSnapshot{};
+        std::string out;
+        if ((sections & StatsSection) != 0) {
+            write_stats(out, snapshot, stats_ != nullptr ? stats_->sample_ops_per_sec() : 0.0);
+        }
+        if ((sections & CommandStatsSection) != 0) {
+            if (!out.empty()) {
+                out += "\r\n";
+            }
+            write_command_stats(out, snapshot);
+        }
+        if ((sections & LatencyStatsSection) != 0) {
+            if (!out.empty()) {
+                out += "\r\n";
+            }
+            write_latency_stats(out, stats_ != nullptr ? stats_->latency_snapshot() : LatencySnapshot{});
+        }
+
+        auto const length = out.size();
+        return protocol::BulkString{.value = std::move(out), .length = length};
+    }
+
+}
@@ -0,0 +1,88 @@
+#include "gmredis/command/latency.h"
+#include "gmredis/command/command_spec.h"
+#include "command_lookup.h"
+#include <algorithm>
+#include <bit>
+
+namespace gmredis::command {
+    constexpr size_t SUBCOMMAND_INDEX = 1;
+    constexpr size_t FIRST_NAME_INDEX = 2;
+
+    namespace {
+        protocol::RespValue bulk(std::string_view value) {
+            return protocol::BulkString{.value = std::string(value), .length = value.size()};
+        }
+
+        /** Cumulative counts at power-of-two microsecond bounds, as Redis reports them. */
+        protocol::Array histogram_usec(const HistogramSnapshot& histogram) {
+            protocol::Array buckets;
+            std::uint64_t cumulative = 0;
+            for (std::size_t i = 0; i < histogram.buckets.size(); i++) {
+                if (histogram.buckets[i] == 0) {
+                    continue;
+                }
+                cumulative += histogram.buckets[i];
+
+                auto const usec = (latency_buckets::highest_of(i) + 999) / 1000;
+                auto const bound = static_cast<std::int64_t>(std::bit_ceil(std::max<std::uint64_t>(usec, 1)));
+                auto const last = buckets.values.size();
+                if (last >= 2 && std::get<protocol::Integer>(buckets.values[last - 2]).value == bound) {
+                    buckets.values[last - 1] = protocol::Integer{static_cast<std::int64_t>(cumulative)};
+                } else {
+                    buckets.values.emplace_back(protocol::Integer{bound});
+                    buckets.values.emplace_back(protocol::Integer{static_cast<std::int64_t>(cumulative)});
+                }
+            }
+            return buckets;
+        }
+
+        void describe(protocol::Array& out, const CommandSpec& spec, const HistogramSnapshot& histogram) {
+            protocol::Array description;
+            description.values.reserve(4);
+            description.values.push_back(bulk("calls"));
+            description.values.emplace_back(protocol::Integer{static_cast<std::int64_t>(histogram.total())});
+            description.values.push_back(bulk("histogram_usec"));
+            description.values.emplace_back(histogram_usec(histogram));
+
+            out.values.push_back(bulk(spec.name));
+            out.values.emplace_back(std::move(description));
+        }
+    }
+
+    std::optional<CommandError> LatencyCommand::doValidate(const protocol::ArrayRef& arg) {
+        auto const subcommand = std::get<protocol::BulkStringView>(arg[SUBCOMMAND_INDEX]).value;
+        if (!detail::equals_ignore_case(subcommand, "histogram")) {
+            return CommandError(CommandErrorCode::InvalidArgument,
+                                "unknown subcommand '" + std::string(subcommand) + "'. Try LATENCY HELP.");
+        }
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> LatencyCommand::doExecute(const protocol::ArrayRef& arg) {
+        protocol::Array histograms;
+        if (stats_ == nullptr) {
+            return histograms;
+        }
+
+        auto const snapshot = stats_->latency_snapshot();
+        auto const add = [&](const CommandSpec& spec) {
+            const auto& histogram = snapshot.commands[static_cast<std::size_t>(spec.type)];
+            if (histogram.total() != 0) {
+                describe(histograms, spec, histogram);
+            }
+        };
+
+        if (arg.size() == FIRST_NAME_INDEX) {
+            std::ranges::for_each(command_specs, add);
+            return histograms;
+        }
+
+        for (auto i = FIRST_NAME_INDEX; i < arg.size(); i++) {
+            if (auto const type = get_command(std::get<protocol::BulkStringView>(arg[i]).value); type.has_value()) {
+                add(command_spec(type.value()));
+            }
+        }
+        return histograms;
+    }
+
+}
@@ -0,0 +1,39 @@
+#include "gmredis/command/latency_histogram.h"
+#include <cmath>
+
+namespace gmredis::command {
+
+    std::uint64_t HistogramSnapshot::total() const noexcept {
+        std::uint64_t total = 0;
+        for (auto count : buckets) {
+            total += count;
+        }
+        return total;
+    }
+
+    std::uint64_t HistogramSnapshot::value_at_percentile(double percentile) const noexcept {
+        auto const all = total();
+        if (all == 0) {
+            return 0;
+        }
+
+        // The rank of the value sought, at least the first one
+        auto const rank = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(all))));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < buckets.size(); i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return latency_buckets::highest_of(i);
+            }
+        }
+        return latency_buckets::highest_of(buckets.size() - 1);
+    }
+
+    void LatencyHistogram::add_to(HistogramSnapshot& snapshot) const noexcept {
+        for (std::size_t i = 0; i < buckets_.size(); i++) {
+            snapshot.buckets[i] += buckets_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+}
@@ -0,0 +1,30 @@
+#include "gmredis/command/set.h"
+#include "gmredis/protocol/shared_replies.h"
+
+namespace gmredis::command {
+    constexpr size_t SET_ARGS = 3; // command + key + value
+    constexpr size_t KEY_INDEX = 1;
+    constexpr size_t VALUE_INDEX = 2;
+
+    std::optional<CommandError> SetCommand::doValidate(const protocol::ArrayRef& arg) {
+        // The spec admits options after the value (EX, PX, NX, ...), none of which are supported yet
+        if (arg.size() != SET_ARGS) {
+            return CommandError(CommandErrorCode::InvalidArgument, "syntax error");
+        }
+
+        return std::nullopt;
+    }
+
+    std::expected<protocol::RespValue, CommandError> SetCommand::doExecute(const protocol::ArrayRef& arg) {
+        auto const key = std::get<protocol::BulkStringView>(arg[KEY_INDEX]).value;
+        auto const value = std::get<protocol::BulkStringView>(arg[VALUE_INDEX]).value;
+
+        auto result = store_->put(key, value);
+        if (!result.has_value()) {
+            return std::unexpected(CommandError(CommandErrorCode::ExecutionFailed, result.error().message));
+        }
+
+        return protocol::shared::ok;
+    }
+
+}
@@ -0,0 +1,126 @@
+#include "gmredis/command/slowlog.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <variant>
+
+namespace gmredis::command {
+
+    SlowLog::SlowLog(std::chrono::microseconds threshold, std::size_t capacity)
+        : threshold_(threshold), capacity_(std::max<std::size_t>(capacity, 1)),
+          slots_(std::make_unique<Slot[]>(capacity_)) {}
+
+    bool SlowLog::record(const protocol::ArrayRef& args, std::chrono::nanoseconds elapsed) noexcept {
+        auto const id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        auto& slot = slots_[id % capacity_];
+        if (slot.busy.exchange(true, std::memory_order_acquire)) {
+            return false;
+        }
+        // A writer that lapped this one may already have stored a newer entry
+        if (slot.sequence > id) {
+            slot.busy.store(false, std::memory_order_release);
+            return false;
+        }
+
+        slot.sequence = id + 1;
+        slot.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        slot.duration_us = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+        slot.argument_count = args.size();
+        // Room is left for the "... (N more arguments)" marker
+        slot.kept_arguments = args.size() > max_arguments ? max_arguments - 1 : args.size();
+        for (std::size_t i = 0; i < slot.kept_arguments; i++) {
+            auto const value = args[i];
+            auto const* bulk = std::get_if<protocol::BulkStringView>(&value);
+            auto const bytes = bulk != nullptr ? bulk->value : std::string_view{};
+            slot.lengths[i] = bytes.size();
+            std::memcpy(slot.bytes.data() + i * max_argument_length, bytes.data(), std::min(bytes.size(), max_argument_length));
+        }
+
+        auto const client = ClientScope::current().substr(0, slot.client.size());
+        std::memcpy(slot.client.data(), client.data(), client.size());
+        slot.client_length = client.size();
+
+        slot.busy.store(false, std::memory_order_release);
+        return true;
+    }
+
+    void SlowLog::acquire(const Slot& slot) noexcept {
+        while (slot.busy.exchange(true, std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    bool SlowLog::read(const Slot& slot, std::uint64_t id, SlowLogEntry& entry) const {
+        acquire(slot);
+
+        bool const found = slot.sequence == id + 1;
+        if (found) {
+            entry.id = id;
+            entry.timestamp = slot.timestamp;
+            entry.duration_us = slot.duration_us;
+            entry.arguments.clear();
+            entry.arguments.reserve(slot.kept_arguments + 1);
+            for (std::size_t i = 0; i < slot.kept_arguments; i++) {
+                auto const length = slot.lengths[i];
+                auto& argument = entry.arguments.emplace_back(slot.bytes.data() + i * max_argument_length,
+                                                              std::min(length, max_argument_length));
+                if (length > max_argument_length) {
+                    argument += "... (" + std::to_string(length - max_argument_length) + " more bytes)";
+                }
+            }
+            if (slot.kept_arguments < slot.argument_count) {
+                entry.arguments.push_back("... (" + std::to_string(slot.argument_count - slot.kept_arguments) +
+                                          " more arguments)");
+            }
+            entry.client_address.assign(slot.client.data(), slot.client_length);
+        }
+
+        slot.busy.store(false, std::memory_order_release);
+        return found;
+    }
+
+    std::vector<SlowLogEntry> SlowLog::entries(std::size_t count) const {
+        auto const next = next_id_.load(std::memory_order_relaxed);
+        auto const oldest = oldest_id(next);
+
+        std::vector<SlowLogEntry> entries;
+        SlowLogEntry entry;
+        for (auto id = next; id > oldest && entries.size() < count; id--) {
+            // Entries still being written, or dropped, are skipped
+            if (read(slots_[(id - 1) % capacity_], id - 1, entry)) {
+                entries.push_back(std::move(entry));
+            }
+        }
+        return entries;
+    }
+
+    std::size_t SlowLog::size() const noexcept {
+        auto const next = next_id_.load(std::memory_order_relaxed);
+        auto const oldest = oldest_id(next);
+
+        // Ids of dropped writes were still handed out, so the slots are counted rather than the
+        // ids: one holding an id in [oldest, next) is an entry entries() would return
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < capacity_; i++) {
+            auto const& slot = slots_[i];
+            acquire(slot);
+            auto const sequence = slot.sequence;
+            slot.busy.store(false, std::memory_order_release);
+            if (sequence > oldest && sequence <= next) {
+                size++;
+            }
+        }
+        return size;
+    }
+
+    std::uint64_t SlowLog::oldest_id(std::uint64_t next) const noexcept {
+        return std::max(first_id_.load(std::memory_order_relaxed), next > capacity_ ? next - capacity_ : 0);
+    }
+
+    void SlowLog::reset() noexcept {
+        first_id_.store(next_id_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+}
@@ -0,0 +1,93 @@
+#include "gmredis/command/slowlog_command.h"
+#include "gmredis/protocol/shared_replies.h"
+#include "command_lookup.h"
+#include <charconv>
+
+namespace gmredis::command {
+    constexpr size_t SUBCOMMAND_INDEX = 1;
+    constexpr size_t COUNT_INDEX = 2;
+    constexpr std::int64_t DEFAULT_COUNT = 10;
+
+    namespace {
+        std::optional<std::int64_t> parse_count(std::string_view text) {
+            std::int64_t value = 0;
+            auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec != std::errc() || ptr != text.data() + text.size() || value < -1) {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        void describe(protocol::ReplySink& sink, const SlowLogEntry& entry) {
+            sink.begin_array(6);
+            sink.integer(static_cast<std::int64_t>(entry.id));
+            sink.integer(entry.timestamp);
+            sink.integer(static_cast<std::int64_t>(entry.duration_us));
+            sink.begin_array(entry.arguments.size());
+            for (const auto& argument : entry.arguments) {
+                sink.bulk(argument);
+            }
+            sink.bulk(entry.client_address);
+            sink.write(protocol::shared::empty_bulk);
+        }
+    }
+
+    std::optional<CommandError> SlowLogCommand::doValidate(const protocol::ArrayRef& arg) {
+        auto const subcommand = std::get<protocol::BulkStringView>(arg[SUBCOMMAND_INDEX]).value;
+        if (detail::equals_ignore_case(subcommand, "get")) {
+            if (arg.size() > COUNT_INDEX + 1) {
+                return CommandError(CommandErrorCode::WrongArgumentCount, "wrong number of arguments for 'slowlog|get' command");
+            }
+            if (arg.size() == COUNT_INDEX + 1 &&
+                !parse_count(std::get<protocol::BulkStringView>(arg[COUNT_INDEX]).value).has_value()) {
+                return CommandError(CommandErrorCode::InvalidArgument, "count should be greater than or equal to -1");
+            }
+            return std::nullopt;
+        }
+        if (detail::equals_ignore_case(subcommand, "len") || detail::equals_ignore_case(subcommand, "reset")) {
+            if (arg.size() != COUNT_INDEX) {
+                return CommandError(CommandErrorCode::WrongArgumentCount,
+                                    "wrong number of arguments for 'slowlog|" + std::string(subcommand) + "' command");
+            }
+            return std::nullopt;
+        }
+        return CommandError(CommandErrorCode::InvalidArgument,
+                            "unknown subcommand '" + std::string(subcommand) + "'. Try SLOWLOG HELP.");
+    }
+
+    std::expected<protocol::RespValue, CommandError> SlowLogCommand::doExecute(const protocol::ArrayRef& arg) {
+        return materialize(arg);
+    }
+
+    std::optional<CommandError> SlowLogCommand::doExecuteInto(const protocol::ArrayRef& arg, protocol::ReplySink& sink) {
+        auto const subcommand = std::get<protocol::BulkStringView>(arg[SUBCOMMAND_INDEX]).value;
+        if (detail::equals_ignore_case(subcommand, "len")) {
+            sink.integer(slowlog_ != nullptr ? static_cast<std::int64_t>(slowlog_->size()) : 0);
+            return std::nullopt;
+        }
+        if (detail::equals_ignore_case(subcommand, "reset")) {
+            if (slowlog_ != nullptr) {
+                slowlog_->reset();
+            }
+            sink.write(protocol::shared::ok);
+            return std::nullopt;
+        }
+
+        // GET
+        auto const count = arg.size() > COUNT_INDEX
+                               ? parse_count(std::get<protocol::BulkStringView>(arg[COUNT_INDEX]).value).value()
+                               : DEFAULT_COUNT;
+        if (slowlog_ == nullptr) {
+            sink.write(protocol::shared::empty_array);
+            return std::nullopt;
+        }
+
+        auto const entries = slowlog_->entries(count < 0 ? slowlog_->capacity() : static_cast<std::size_t>(count));
+        sink.begin_array(entries.size());
+        for (const auto& entry : entries) {
+            describe(sink, entry);
+        }
+        return std::nullopt;
+    }
+
+}
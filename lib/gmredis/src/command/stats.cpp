@@ -0,0 +1,80 @@
+#include "gmredis/command/stats.h"
+#include <algorithm>
+
+namespace gmredis::command {
+    namespace {
+        std::atomic<std::uint64_t> next_stats_id{1};
+
+        std::uint64_t read(const std::atomic<std::uint64_t>& counter) noexcept {
+            return counter.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t StatsSnapshot::total_commands_processed() const noexcept {
+        std::uint64_t total = 0;
+        for (const auto& counters : commands) {
+            total += counters.calls;
+        }
+        return total;
+    }
+
+    Stats::Stats()
+        : id_(next_stats_id.fetch_add(1, std::memory_order_relaxed)),
+          sampled_at_(std::chrono::steady_clock::now()) {}
+
+    Stats::Shard& Stats::attach() {
+        std::lock_guard lock(mutex_);
+        auto const thread = std::this_thread::get_id();
+        auto it = std::ranges::find(shards_, thread, &decltype(shards_)::value_type::first);
+        if (it != shards_.end()) {
+            return *it->second;
+        }
+        return *shards_.emplace_back(thread, std::make_unique<Shard>()).second;
+    }
+
+    StatsSnapshot Stats::snapshot() const {
+        StatsSnapshot snapshot;
+        std::lock_guard lock(mutex_);
+        for (const auto& [thread, shard] : shards_) {
+            for (std::size_t i = 0; i < command_type_count; i++) {
+                auto& total = snapshot.commands[i];
+                const auto& counters = shard->commands[i];
+                total.calls += read(counters.calls);
+                total.nanoseconds += read(counters.nanoseconds);
+                total.rejected_calls += read(counters.rejected_calls);
+                total.failed_calls += read(counters.failed_calls);
+            }
+            snapshot.connections_received += read(shard->connections_received);
+            snapshot.net_input_bytes += read(shard->net_input_bytes);
+            snapshot.net_output_bytes += read(shard->net_output_bytes);
+        }
+        return snapshot;
+    }
+
+    LatencySnapshot Stats::latency_snapshot() const {
+        LatencySnapshot snapshot;
+        std::lock_guard lock(mutex_);
+        for (const auto& [thread, shard] : shards_) {
+            for (std::size_t i = 0; i < command_type_count; i++) {
+                shard->command_latency[i].add_to(snapshot.commands[i]);
+            }
+            shard->request_latency.add_to(snapshot.requests);
+        }
+        return snapshot;
+    }
+
+    double Stats::sample_ops_per_sec() {
+        auto const commands = snapshot().total_commands_processed();
+        auto const now = std::chrono::steady_clock::now();
+
+        std::lock_guard lock(rate_mutex_);
+        std::chrono::duration<double> const elapsed = now - sampled_at_;
+        if (elapsed >= std::chrono::milliseconds(100)) {
+            ops_per_sec_ = static_cast<double>(commands - sampled_commands_) / elapsed.count();
+            sampled_at_ = now;
+            sampled_commands_ = commands;
+        }
+        return ops_per_sec_;
+    }
+
+}
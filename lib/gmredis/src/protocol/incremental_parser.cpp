@@ -0,0 +1,176 @@
+#include "gmredis/protocol/incremental_parser.h"
+#include "scan.h"
+#include <algorithm>
+#include <charconv>
+#include <limits>
+
+namespace gmredis::protocol {
+
+    namespace {
+        bool parse_integer(std::string_view text, std::int64_t& value) {
+            if (text.starts_with('+')) {
+                text.remove_prefix(1);
+            }
+            auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return ec == std::errc() && ptr == text.data() + text.size() && !text.empty();
+        }
+    }
+
+    std::expected<RespValueView, ParseError> IncrementalParser::parse(std::string_view input) {
+        if (auto result = parse_tape(input); !result.has_value()) {
+            return std::unexpected{result.error()};
+        }
+        return tape_.value();
+    }
+
+    std::expected<void, ParseError> IncrementalParser::parse_tape(std::string_view input) {
+        if (complete_) {
+            tape_.elements.clear();
+            complete_ = false;
+        }
+
+        for (;;) {
+            if (in_bulk_payload_) {
+                auto end = offset_ + pending_bulk_length_;
+                if (input.size() < end + 2) {
+                    return std::unexpected{ParseError::Incomplete};
+                }
+                if (input[end] != '\r' || input[end + 1] != '\n') {
+                    return fail(ParseError::Invalid);
+                }
+
+                tape_.elements.push_back({.kind = TapeKind::BulkString, .offset = offset_, .length = pending_bulk_length_});
+                offset_ = end + 2;
+                in_bulk_payload_ = false;
+                if (complete_element()) {
+                    finish(input);
+                    return {};
+                }
+                continue;
+            }
+
+            if (offset_ >= input.size()) {
+                return std::unexpected{ParseError::Incomplete};
+            }
+
+            auto const type = input[offset_];
+            if (type != '+' && type != '-' && type != ':' && type != '$' && type != '*') {
+                return fail(ParseError::Unsupported);
+            }
+
+            auto crlf = find_crlf(input, std::max(scan_from_, offset_ + 1));
+            if (crlf == std::string_view::npos) {
+                // The last byte may be the '\r' of a line that is exactly at the limit. Without a
+                // CRLF, everything up to the end of input belongs to this frame
+                if (input.size() - offset_ - 1 > limits_.max_inline_length + 1 || input.size() > limits_.max_frame_length) {
+                    return fail(ParseError::LimitExceeded);
+                }
+                // A '\r' at the very end may still be followed by '\n'
+                scan_from_ = std::max(offset_ + 1, input.size() - 1);
+                return std::unexpected{ParseError::Incomplete};
+            }
+            scan_from_ = 0;
+
+            auto const line = input.substr(offset_ + 1, crlf - offset_ - 1);
+            if (line.size() > limits_.max_inline_length) {
+                return fail(ParseError::LimitExceeded);
+            }
+            auto const line_offset = offset_ + 1;
+            offset_ = crlf + 2;
+            if (offset_ > limits_.max_frame_length) {
+                return fail(ParseError::LimitExceeded);
+            }
+
+            switch (type) {
+                case '+':
+                    tape_.elements.push_back({.kind = TapeKind::SimpleString, .offset = line_offset, .length = line.size()});
+                    break;
+                case '-':
+                    tape_.elements.push_back({.kind = TapeKind::SimpleError, .offset = line_offset, .length = line.size()});
+                    break;
+                case ':': {
+                    std::int64_t value = 0;
+                    if (!parse_integer(line, value)) {
+                        return fail(ParseError::Invalid);
+                    }
+                    tape_.elements.push_back({.kind = TapeKind::Integer, .integer = value});
+                    break;
+                }
+                case '$': {
+                    if (line == "-1") {
+                        tape_.elements.push_back({.kind = TapeKind::Null});
+                        break;
+                    }
+                    // The payload end must be representable as an offset
+                    if (!parse_decimal(line, pending_bulk_length_) ||
+                        pending_bulk_length_ > std::numeric_limits<std::size_t>::max() / 2) {
+                        return fail(ParseError::Invalid);
+                    }
+                    if (pending_bulk_length_ > limits_.max_bulk_length ||
+                        pending_bulk_length_ + 2 > limits_.max_frame_length - offset_) {
+                        return fail(ParseError::LimitExceeded);
+                    }
+                    in_bulk_payload_ = true;
+                    continue;
+                }
+                default: {  // '*'
+                    std::size_t count = 0;
+                    if (!parse_decimal(line, count)) {
+                        return fail(ParseError::Invalid);
+                    }
+                    if (count > limits_.max_multibulk_length || open_arrays_.size() >= limits_.max_nesting_depth) {
+                        return fail(ParseError::LimitExceeded);
+                    }
+                    auto const index = tape_.elements.size();
+                    tape_.elements.push_back({.kind = TapeKind::Array, .length = count, .end = index + 1});
+                    if (count > 0) {
+                        open_arrays_.push_back({.index = index, .remaining = count});
+                        continue;
+                    }
+                    break;
+                }
+            }
+
+            if (complete_element()) {
+                finish(input);
+                return {};
+            }
+        }
+    }
+
+    void IncrementalParser::reset() noexcept {
+        tape_.elements.clear();
+        complete_ = false;
+        open_arrays_.clear();
+        offset_ = 0;
+        scan_from_ = 0;
+        pending_bulk_length_ = 0;
+        in_bulk_payload_ = false;
+    }
+
+    bool IncrementalParser::complete_element() noexcept {
+        // A finished element may finish its parent array, which may finish its parent, ...
+        while (!open_arrays_.empty()) {
+            if (--open_arrays_.back().remaining > 0) {
+                return false;
+            }
+            tape_.elements[open_arrays_.back().index].end = tape_.elements.size();
+            open_arrays_.pop_back();
+        }
+        return true;
+    }
+
+    void IncrementalParser::finish(std::string_view input) noexcept {
+        tape_.input = input;
+        frame_size_ = offset_;
+        offset_ = 0;
+        scan_from_ = 0;
+        complete_ = true;
+    }
+
+    std::unexpected<ParseError> IncrementalParser::fail(ParseError error) noexcept {
+        reset();
+        return std::unexpected{error};
+    }
+
+}
@@ -1,11 +1,26 @@
 #include "gmredis/protocol/parse.h"
+#include "scan.h"
+#include <algorithm>
 #include <expected>
 #include <string>
 #include <charconv>
+#include <limits>
 #include <vector>
 
 namespace gmredis::protocol {
-    std::expected<RespValue, ParseError> parse_simple_string([[maybe_unused]]std::string_view& input) {
+    namespace {
+        // The shortest possible value, e.g. "+\r\n"
+        constexpr std::size_t min_encoded_size = 3;
+
+        std::expected<RespValue, ParseError> owned(std::expected<RespValueView, ParseError> view) {
+            if (!view.has_value()) {
+                return std::unexpected{view.error()};
+            }
+            return to_owned(*view);
+        }
+    }
+
+    std::expected<RespValueView, ParseError> parse_simple_string_view(std::string_view& input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -14,17 +29,17 @@ namespace gmredis::protocol {
             return std::unexpected{ParseError::Invalid};
         }
 
-        auto crlf = input.find("\r\n");
+        auto crlf = find_crlf(input);
         if (crlf == std::string_view::npos) {
             return std::unexpected{ParseError::Incomplete};
         }
 
-        std::string const value{input.substr(1, crlf - 1)};
+        auto const value = input.substr(1, crlf - 1);
         input.remove_prefix(crlf + 2);
-        return SimpleString{value};
+        return SimpleStringView{value};
     }
 
-    std::expected<RespValue, ParseError> parse_error(std::string_view& input) {
+    std::expected<RespValueView, ParseError> parse_error_view(std::string_view& input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -33,17 +48,17 @@ namespace gmredis::protocol {
             return std::unexpected{ParseError::Invalid};
         }
 
-        auto crlf = input.find("\r\n");
+        auto crlf = find_crlf(input);
         if (crlf == std::string_view::npos) {
             return std::unexpected{ParseError::Incomplete};
         }
 
-        std::string const value{input.substr(1, crlf - 1)};
+        auto const value = input.substr(1, crlf - 1);
         input.remove_prefix(crlf + 2);
-        return SimpleError{value};
+        return SimpleErrorView{value};
     }
 
-    std::expected<RespValue, ParseError> parse_bulk_string(std::string_view &input) {
+    std::expected<RespValueView, ParseError> parse_bulk_string_view(std::string_view &input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -54,9 +69,9 @@ namespace gmredis::protocol {
 
         //First thing we do is find the first crlf; keep that value
         //Get the substring from 1-crlf-1, which will tell us the length of the string
-        //Next, starting from crlf + 1, find the next crlf to get the string
+        //The payload and its trailing crlf then sit at a known offset, no second scan needed
 
-        auto crlf = input.find("\r\n");
+        auto crlf = find_crlf(input);
         if (crlf == std::string_view::npos) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -65,26 +80,31 @@ namespace gmredis::protocol {
 
         auto const length_str {input.substr(1, crlf - 1)};
 
-        size_t length = 0;
-        auto [ptr, ec] = std::from_chars(length_str.data(), length_str.data() + length_str.size(), length);
-
-        if (ec != std::errc()) {
-            return std::unexpected{ParseError::Incomplete};
+        if (length_str == "-1") {
+            input.remove_prefix(next);
+            return Null{};
         }
 
-        std::string const value{input.substr(next,  length)};
+        size_t length = 0;
+        if (!parse_decimal(length_str, length) || length > std::numeric_limits<size_t>::max() / 2) {
+            return std::unexpected{ParseError::Invalid};
+        }
 
-        //Get the next crlf to ensure we are done
-        crlf = input.find("\r\n", next + length);
-        if (crlf == std::string_view::npos) {
+        auto const end = next + length;
+        if (input.size() < end + 2) {
             return std::unexpected{ParseError::Incomplete};
         }
-        input.remove_prefix(crlf + 2);
+        if (input[end] != '\r' || input[end + 1] != '\n') {
+            return std::unexpected{ParseError::Invalid};
+        }
+
+        auto const value = input.substr(next, length);
+        input.remove_prefix(end + 2);
 
-        return BulkString{.value=value, .length=length};
+        return BulkStringView{value};
     }
 
-    std::expected<RespValue, ParseError> parse_integer(std::string_view &input) {
+    std::expected<RespValueView, ParseError> parse_integer_view(std::string_view &input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -93,7 +113,7 @@ namespace gmredis::protocol {
             return std::unexpected{ParseError::Invalid};
         }
 
-        auto crlf = input.find("\r\n");
+        auto crlf = find_crlf(input);
         if (crlf == std::string_view::npos) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -116,7 +136,7 @@ namespace gmredis::protocol {
         return Integer{i_value};
     }
 
-    std::expected<RespValue, ParseError> parse_array(std::string_view &input) {
+    std::expected<RespValueView, ParseError> parse_array_view(std::string_view &input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
@@ -125,48 +145,70 @@ namespace gmredis::protocol {
             return std::unexpected{ParseError::Invalid};
         }
 
-        auto crlf = input.find("\r\n");
+        auto crlf = find_crlf(input);
         if (crlf == std::string_view::npos) {
             return std::unexpected{ParseError::Incomplete};
         }
 
-        std::string const length_str{input.substr(1, crlf - 1)};
+        auto const length_str = input.substr(1, crlf - 1);
 
         size_t array_length = 0;
-        auto [ptr, ec] = std::from_chars(length_str.data(), length_str.data() + length_str.size(), array_length);
-
-        if (ec != std::errc()) {
+        if (!parse_decimal(length_str, array_length)) {
             return std::unexpected{ParseError::Invalid};
         }
 
         input.remove_prefix(crlf + 2);
-        std::vector<RespValue> array_values = {};
-        array_values.reserve(array_length);
+        ArrayView array;
+        // The declared length is untrusted: reserve no more than the input can hold
+        array.values.reserve(std::min(array_length, input.size() / min_encoded_size));
 
         for (size_t i = 0; i < array_length; i++) {
-            auto result = parse(input);
+            auto result = parse_view(input);
             if (!result.has_value()) {
                 return std::unexpected{result.error()};
             }
 
-            array_values.push_back(*std::move(result));
+            array.values.push_back(*result);
         }
 
-        return Array{array_values};
+        return array;
     }
 
-    std::expected<RespValue, ParseError> parse(std::string_view& input) {
+    std::expected<RespValue, ParseError> parse_simple_string(std::string_view& input) {
+        return owned(parse_simple_string_view(input));
+    }
+
+    std::expected<RespValue, ParseError> parse_error(std::string_view& input) {
+        return owned(parse_error_view(input));
+    }
+
+    std::expected<RespValue, ParseError> parse_bulk_string(std::string_view& input) {
+        return owned(parse_bulk_string_view(input));
+    }
+
+    std::expected<RespValue, ParseError> parse_integer(std::string_view& input) {
+        return owned(parse_integer_view(input));
+    }
+
+    std::expected<RespValue, ParseError> parse_array(std::string_view& input) {
+        return owned(parse_array_view(input));
+    }
+
+    std::expected<RespValueView, ParseError> parse_view(std::string_view& input) {
         if (input.empty()) {
             return std::unexpected{ParseError::Incomplete};
         }
 
         // Get the first character to determine the type
-        char const prefix = input.front();
-        auto const parser = parser_table[static_cast<unsigned char>(prefix)];
-        if (parser == nullptr) {
+        auto const prefix = static_cast<unsigned char>(input.front());
+        if (prefix >= view_parser_table.size() || view_parser_table[prefix] == nullptr) {
             return std::unexpected{ParseError::Unsupported};
         }
 
-        return parser(input);
+        return view_parser_table[prefix](input);
+    }
+
+    std::expected<RespValue, ParseError> parse(std::string_view& input) {
+        return owned(parse_view(input));
     }
 }
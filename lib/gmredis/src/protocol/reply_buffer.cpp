@@ -0,0 +1,34 @@
+#include "gmredis/protocol/reply_buffer.h"
+#include <utility>
+
+namespace gmredis::protocol {
+
+    void ReplyBuffer::append_reference(std::shared_ptr<const std::string> value) {
+        referenced_ += value->size();
+        references_.push_back({bytes_.size(), std::move(value)});
+    }
+
+    void ReplyBuffer::rewind(std::size_t bytes_mark) {
+        // A reference is always followed by the bulk string's CRLF, so one spliced in before
+        // the mark was taken sits strictly before it
+        while (!references_.empty() && references_.back().offset >= bytes_mark) {
+            referenced_ -= references_.back().value->size();
+            references_.pop_back();
+        }
+        bytes_.resize(bytes_mark);
+    }
+
+    void ReplyBuffer::clear() noexcept {
+        bytes_.clear();
+        references_.clear();
+        referenced_ = 0;
+    }
+
+    std::string ReplyBuffer::str() const {
+        std::string flat;
+        flat.reserve(size());
+        for_each_chunk([&flat](std::string_view chunk) { flat.append(chunk); });
+        return flat;
+    }
+
+}
@@ -0,0 +1,93 @@
+#include "gmredis/protocol/reply_sink.h"
+#include "gmredis/protocol/serialize.h"
+#include "gmredis/protocol/shared_replies.h"
+#include <array>
+#include <charconv>
+#include <cstring>
+
+namespace gmredis::protocol {
+
+    namespace {
+        constexpr std::string_view crlf = "\r\n";
+        constexpr std::string_view null_reply = "$-1\r\n";
+
+        /** Room for a type byte, the sign and digits of any 64-bit integer, and CRLF. */
+        using HeaderBuffer = std::array<char, 24>;
+
+        /** Writes "<type><value>\r\n" to the start of buffer and returns its length. */
+        template <typename T>
+        std::size_t format_header(HeaderBuffer& buffer, char type, T value) noexcept {
+            buffer[0] = type;
+            auto* end = std::to_chars(buffer.data() + 1, buffer.data() + buffer.size(), value).ptr;
+            *end++ = '\r';
+            *end++ = '\n';
+            return static_cast<std::size_t>(end - buffer.data());
+        }
+    }
+
+    void ReplySink::begin_array(std::size_t count) {
+        HeaderBuffer buffer;
+        output_.append(buffer.data(), format_header(buffer, '*', count));
+    }
+
+    void ReplySink::bulk(std::string_view value) {
+        HeaderBuffer buffer;
+        auto const header_size = format_header(buffer, '$', value.size());
+
+        // One resize for the whole element, however large the payload
+        auto const offset = output_.size();
+        auto const size = header_size + value.size() + crlf.size();
+        output_.resize_and_overwrite(offset + size, [&](char* data, std::size_t) {
+            auto* out = data + offset;
+            std::memcpy(out, buffer.data(), header_size);
+            std::memcpy(out + header_size, value.data(), value.size());
+            std::memcpy(out + header_size + value.size(), crlf.data(), crlf.size());
+            return offset + size;
+        });
+    }
+
+    void ReplySink::bulk(const std::shared_ptr<const std::string>& value) {
+        if (references_ == nullptr) {
+            bulk(std::string_view(*value));
+            return;
+        }
+        HeaderBuffer buffer;
+        output_.append(buffer.data(), format_header(buffer, '$', value->size()));
+        references_->append_reference(value);
+        output_.append(crlf);
+    }
+
+    void ReplySink::simple_string(std::string_view value) {
+        output_ += '+';
+        output_.append(value);
+        output_.append(crlf);
+    }
+
+    void ReplySink::error(std::string_view message) {
+        output_ += '-';
+        output_.append(message);
+        output_.append(crlf);
+    }
+
+    void ReplySink::integer(std::int64_t value) {
+        if (value >= 0 && value < shared::integer_count) {
+            output_.append(shared::integer(value).bytes);
+            return;
+        }
+        HeaderBuffer buffer;
+        output_.append(buffer.data(), format_header(buffer, ':', value));
+    }
+
+    void ReplySink::null() {
+        output_.append(null_reply);
+    }
+
+    void ReplySink::write(const EncodedReply& reply) {
+        output_.append(reply.bytes);
+    }
+
+    void ReplySink::write(const RespValue& value) {
+        serialize_to(output_, value);
+    }
+
+}
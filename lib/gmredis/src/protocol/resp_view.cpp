@@ -0,0 +1,81 @@
+#include "gmredis/protocol/resp_view.h"
+#include "gmredis/protocol/parse.h"
+
+namespace gmredis::protocol {
+
+    namespace {
+        struct ToView {
+            RespValueView operator()(const SimpleString& value) const {
+                return SimpleStringView{value.value};
+            }
+            RespValueView operator()(const SimpleError& value) const {
+                return SimpleErrorView{value.value};
+            }
+            RespValueView operator()(const BulkString& value) const {
+                return BulkStringView{value.value};
+            }
+            RespValueView operator()(const Integer& value) const {
+                return value;
+            }
+            RespValueView operator()(const Array& value) const {
+                return to_view(value);
+            }
+            RespValueView operator()(const Null& value) const {
+                return value;
+            }
+            RespValueView operator()(const EncodedReply& value) const {
+                // Views the encoded bytes, which outlive the value like any other payload
+                std::string_view input = value.bytes;
+                return parse_view(input).value_or(Null{});
+            }
+        };
+
+        struct ToOwned {
+            RespValue operator()(const SimpleStringView& value) const {
+                return SimpleString{std::string(value.value)};
+            }
+            RespValue operator()(const SimpleErrorView& value) const {
+                return SimpleError{std::string(value.value)};
+            }
+            RespValue operator()(const BulkStringView& value) const {
+                return BulkString{.value = std::string(value.value), .length = value.value.size()};
+            }
+            RespValue operator()(const Integer& value) const {
+                return value;
+            }
+            RespValue operator()(const ArrayView& value) const {
+                return to_owned(value);
+            }
+            RespValue operator()(const Null& value) const {
+                return value;
+            }
+        };
+    }
+
+    RespValueView to_view(const RespValue& value) {
+        return std::visit(ToView{}, value);
+    }
+
+    ArrayView to_view(const Array& value) {
+        ArrayView view;
+        view.values.reserve(value.values.size());
+        for (const auto& element : value.values) {
+            view.values.push_back(to_view(element));
+        }
+        return view;
+    }
+
+    RespValue to_owned(const RespValueView& value) {
+        return std::visit(ToOwned{}, value);
+    }
+
+    Array to_owned(const ArrayView& value) {
+        Array array;
+        array.values.reserve(value.values.size());
+        for (const auto& element : value.values) {
+            array.values.push_back(to_owned(element));
+        }
+        return array;
+    }
+
+}
@@ -0,0 +1,129 @@
+#include "scan.h"
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GMREDIS_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace gmredis::protocol {
+
+    namespace {
+        std::size_t find_crlf_scalar(std::string_view input, std::size_t from) noexcept {
+            for (auto i = from; i + 1 < input.size(); i++) {
+                if (input[i] == '\r' && input[i + 1] == '\n') {
+                    return i;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+#if defined(GMREDIS_SCAN_X86)
+        // Checks the byte after each '\r' in a block mask; a lone '\r' is rare in RESP, so
+        // comparing against '\n' as well costs more than it saves.
+        std::size_t match_crlf(std::string_view input, std::size_t base, unsigned mask) noexcept {
+            while (mask != 0) {
+                auto const i = base + static_cast<std::size_t>(std::countr_zero(mask));
+                if (i + 1 >= input.size()) {
+                    return std::string_view::npos;
+                }
+                if (input[i + 1] == '\n') {
+                    return i;
+                }
+                mask &= mask - 1;
+            }
+            return std::string_view::npos;
+        }
+
+        std::size_t find_crlf_sse2(std::string_view input, std::size_t from) noexcept {
+            const char* data = input.data();
+            auto const cr = _mm_set1_epi8('\r');
+
+            auto i = from;
+            for (; i + 16 <= input.size(); i += 16) {
+                auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, cr)));
+                if (auto found = match_crlf(input, i, mask); found != std::string_view::npos) {
+                    return found;
+                }
+            }
+            return find_crlf_scalar(input, i);
+        }
+
+        __attribute__((target("avx2"))) std::size_t find_crlf_avx2(std::string_view input, std::size_t from) noexcept {
+            const char* data = input.data();
+            auto const cr = _mm256_set1_epi8('\r');
+
+            // Most header lines end within 16 bytes; start with one narrow block so short
+            // lines do not pay for the wide one.
+            auto i = from;
+            if (i + 16 <= input.size()) {
+                auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8('\r'))));
+                if (auto found = match_crlf(input, i, mask); found != std::string_view::npos) {
+                    return found;
+                }
+                i += 16;
+            }
+            for (; i + 32 <= input.size(); i += 32) {
+                auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, cr)));
+                if (auto found = match_crlf(input, i, mask); found != std::string_view::npos) {
+                    return found;
+                }
+            }
+            return find_crlf_sse2(input, i);
+        }
+#endif
+
+        std::vector<CrlfScanner> detect_scanners() {
+            std::vector<CrlfScanner> scanners{{"scalar", find_crlf_scalar}};
+#if defined(GMREDIS_SCAN_X86)
+            // SSE2 is part of the x86-64 baseline
+            scanners.push_back({"sse2", find_crlf_sse2});
+            if (__builtin_cpu_supports("avx2")) {
+                scanners.push_back({"avx2", find_crlf_avx2});
+            }
+#endif
+            return scanners;
+        }
+
+        const std::vector<CrlfScanner>& available_scanners() {
+            static const auto scanners = detect_scanners();
+            return scanners;
+        }
+
+    }
+
+    std::span<const CrlfScanner> crlf_scanners() noexcept {
+        return available_scanners();
+    }
+
+    std::size_t find_crlf(std::string_view input, std::size_t from) noexcept {
+        static const auto find = available_scanners().back().find;
+        return find(input, from);
+    }
+
+    bool parse_decimal(std::string_view text, std::size_t& value) noexcept {
+        // Nineteen digits always fit in 64 bits, so the loop needs no overflow check and
+        // collects the digit test into one flag instead of branching on every byte.
+        if (!text.empty() && text.size() <= 19) {
+            std::uint64_t result = 0;
+            unsigned invalid = 0;
+            for (char c : text) {
+                auto const digit = static_cast<unsigned>(static_cast<unsigned char>(c)) - unsigned{'0'};
+                invalid |= static_cast<unsigned>(digit > 9);
+                result = result * 10 + digit;
+            }
+            value = static_cast<std::size_t>(result);
+            return invalid == 0;
+        }
+
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return !text.empty() && ec == std::errc() && ptr == text.data() + text.size();
+    }
+
+}
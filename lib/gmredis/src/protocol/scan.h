@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace gmredis::protocol {
+
+    /**
+     * @brief One implementation of the CRLF search used by the RESP parsers.
+     */
+    struct CrlfScanner {
+        std::string_view name;
+        /** Offset of the first "\r\n" at or after from, or std::string_view::npos. */
+        std::size_t (*find)(std::string_view input, std::size_t from) noexcept;
+    };
+
+    /**
+     * @brief Every CRLF scanner the running CPU supports, fastest last.
+     *
+     * The scalar scanner is always present; SSE2 and AVX2 variants are added on x86-64 when
+     * the CPU reports them.
+     */
+    std::span<const CrlfScanner> crlf_scanners() noexcept;
+
+    /**
+     * @brief Finds the first "\r\n" at or after from using the fastest available scanner.
+     */
+    std::size_t find_crlf(std::string_view input, std::size_t from = 0) noexcept;
+
+    /**
+     * @brief Parses an unsigned decimal made only of digits, as found in `$` and `*` headers.
+     *
+     * Numbers of up to 19 digits, which cannot overflow, are converted without a per-digit
+     * branch; longer ones take the std::from_chars path.
+     *
+     * @return false if text is empty, holds anything but digits or overflows
+     */
+    bool parse_decimal(std::string_view text, std::size_t& value) noexcept;
+
+}
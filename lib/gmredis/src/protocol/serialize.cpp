@@ -1,36 +1,219 @@
 #include "gmredis/protocol/serialize.h"
-#include <fmt/core.h>
+#include "gmredis/protocol/shared_replies.h"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
 
 namespace gmredis::protocol {
+
+    namespace {
+        constexpr std::string_view crlf = "\r\n";
+        constexpr std::string_view null_reply = "$-1\r\n";
+
+        std::size_t decimal_digits(std::uint64_t value) noexcept {
+            std::size_t digits = 1;
+            while (value >= 10) {
+                value /= 10;
+                digits++;
+            }
+            return digits;
+        }
+
+        bool is_shared_integer(std::int64_t value) noexcept {
+            return value >= 0 && value < shared::integer_count;
+        }
+
+        std::size_t integer_size(std::int64_t value) noexcept {
+            if (value < 0) {
+                // Negate in unsigned arithmetic so INT64_MIN does not overflow
+                return 1 + decimal_digits(0 - static_cast<std::uint64_t>(value));
+            }
+            return decimal_digits(static_cast<std::uint64_t>(value));
+        }
+
+        // Sizes, header included, of each value type
+
+        std::size_t size_of(const RespValue& resp);
+
+        std::size_t size_of(const SimpleString& resp) {
+            return 1 + resp.value.size() + crlf.size();
+        }
+
+        std::size_t size_of(const SimpleError& resp) {
+            return 1 + resp.value.size() + crlf.size();
+        }
+
+        std::size_t size_of(const BulkString& resp) {
+            return 1 + decimal_digits(resp.length) + crlf.size() + resp.value.size() + crlf.size();
+        }
+
+        std::size_t size_of(const Integer& resp) {
+            return 1 + integer_size(resp.value) + crlf.size();
+        }
+
+        std::size_t size_of(const Array& resp) {
+            auto size = 1 + decimal_digits(resp.values.size()) + crlf.size();
+            for (const auto& value : resp.values) {
+                size += size_of(value);
+            }
+            return size;
+        }
+
+        std::size_t size_of([[maybe_unused]] const Null& resp) {
+            return null_reply.size();
+        }
+
+        std::size_t size_of(const EncodedReply& resp) {
+            return resp.bytes.size();
+        }
+
+        std::size_t size_of(const RespValue& resp) {
+            return std::visit([](const auto& value) { return size_of(value); }, resp);
+        }
+
+        // Writers fill exactly size_of() bytes starting at out and return the end
+
+        char* put(char* out, std::string_view text) noexcept {
+            std::memcpy(out, text.data(), text.size());
+            return out + text.size();
+        }
+
+        char* put_header(char* out, char type, std::uint64_t value) noexcept {
+            *out++ = type;
+            out = std::to_chars(out, out + decimal_digits(value), value).ptr;
+            return put(out, crlf);
+        }
+
+        char* write(char* out, const RespValue& resp);
+
+        char* write(char* out, const SimpleString& resp) {
+            *out++ = '+';
+            return put(put(out, resp.value), crlf);
+        }
+
+        char* write(char* out, const SimpleError& resp) {
+            *out++ = '-';
+            return put(put(out, resp.value), crlf);
+        }
+
+        char* write(char* out, const BulkString& resp) {
+            out = put_header(out, '$', resp.length);
+            return put(put(out, resp.value), crlf);
+        }
+
+        char* write(char* out, const Integer& resp) {
+            if (is_shared_integer(resp.value)) {
+                return put(out, shared::integer(resp.value).bytes);
+            }
+            *out++ = ':';
+            out = std::to_chars(out, out + integer_size(resp.value), resp.value).ptr;
+            return put(out, crlf);
+        }
+
+        char* write(char* out, const Array& resp) {
+            out = put_header(out, '*', resp.values.size());
+            for (const auto& value : resp.values) {
+                out = write(out, value);
+            }
+            return out;
+        }
+
+        char* write(char* out, [[maybe_unused]] const Null& resp) {
+            return put(out, null_reply);
+        }
+
+        char* write(char* out, const EncodedReply& resp) {
+            return put(out, resp.bytes);
+        }
+
+        char* write(char* out, const RespValue& resp) {
+            return std::visit([out](const auto& value) { return write(out, value); }, resp);
+        }
+
+        template <typename T>
+        void append(std::string& output, const T& resp) {
+            auto const offset = output.size();
+            auto const size = size_of(resp);
+            output.resize_and_overwrite(offset + size, [&](char* data, std::size_t) {
+                write(data + offset, resp);
+                return offset + size;
+            });
+        }
+
+        template <typename T>
+        std::string to_string(const T& resp) {
+            std::string result;
+            append(result, resp);
+            return result;
+        }
+    }
+
+    std::size_t serialized_size(const RespValue& resp) {
+        return size_of(resp);
+    }
+
+    void serialize_to(std::string& output, const SimpleString& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const SimpleError& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const BulkString& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const Integer& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const Array& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const Null& resp) {
+        append(output, resp);
+    }
+
+    void serialize_to(std::string& output, const EncodedReply& resp) {
+        output.append(resp.bytes);
+    }
+
+    void serialize_to(std::string& output, const RespValue& resp) {
+        append(output, resp);
+    }
+
     std::string serialize(const SimpleString& resp) {
-        return "+" + resp.value + "\r\n";
+        return to_string(resp);
     }
 
     std::string serialize(const SimpleError& resp) {
-        return "-" + resp.value + "\r\n";
+        return to_string(resp);
     }
 
     std::string serialize(const BulkString& resp) {
-        return fmt::format("${}\r\n{}\r\n", resp.length, resp.value);
+        return to_string(resp);
     }
 
     std::string serialize(const Integer& resp) {
-        return fmt::format(":{}\r\n", resp.value);
+        return to_string(resp);
     }
 
     std::string serialize(const Array& resp) {
-        std::string result = fmt::format("*{}\r\n", resp.values.size());
+        return to_string(resp);
+    }
 
-        for (const auto& value : resp.values) {
-            result += serialize(value);
-        }
+    std::string serialize(const Null& resp) {
+        return to_string(resp);
+    }
 
-        return result;
+    std::string serialize(const EncodedReply& resp) {
+        return std::string(resp.bytes);
     }
 
     std::string serialize(const RespValue& resp) {
-        return std::visit([](const auto& value) {
-            return serialize(value);
-        }, resp);
+        return to_string(resp);
     }
-}  // namespace gmredis::protocol
\ No newline at end of file
+}  // namespace gmredis::protocol
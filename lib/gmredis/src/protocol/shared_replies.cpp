@@ -0,0 +1,62 @@
+#include "gmredis/protocol/shared_replies.h"
+#include <array>
+#include <string_view>
+
+namespace gmredis::protocol::shared {
+
+    namespace {
+        constexpr auto integers = static_cast<std::size_t>(integer_count);
+        // ":9999\r\n" is the longest entry
+        constexpr std::size_t stride = 8;
+
+        struct IntegerTable {
+            std::array<char, integers * stride> bytes{};
+            std::array<std::uint8_t, integers> sizes{};
+
+            [[nodiscard]] constexpr std::string_view at(std::size_t value) const {
+                return {bytes.data() + value * stride, sizes[value]};
+            }
+        };
+
+        constexpr IntegerTable make_integer_table() {
+            IntegerTable table;
+            for (std::size_t value = 0; value < integers; value++) {
+                std::array<char, stride> digits{};
+                std::size_t count = 0;
+                auto rest = value;
+                do {
+                    digits[count++] = static_cast<char>('0' + rest % 10);
+                    rest /= 10;
+                } while (rest != 0);
+
+                auto* out = table.bytes.data() + value * stride;
+                *out++ = ':';
+                while (count > 0) {
+                    *out++ = digits[--count];
+                }
+                *out++ = '\r';
+                *out = '\n';
+                table.sizes[value] = static_cast<std::uint8_t>(out + 1 - (table.bytes.data() + value * stride));
+            }
+            return table;
+        }
+
+        constexpr auto integer_table = make_integer_table();
+
+        static_assert(integer_table.at(0) == ":0\r\n");
+        static_assert(integer_table.at(42) == ":42\r\n");
+        static_assert(integer_table.at(integers - 1) == ":9999\r\n");
+    }
+
+    EncodedReply integer(std::int64_t value) noexcept {
+        return EncodedReply{integer_table.at(static_cast<std::size_t>(value))};
+    }
+
+    RespValue integer_reply(std::int64_t value) noexcept {
+        if (value >= 0 && value < integer_count) {
+            return integer(value);
+        }
+        return Integer{value};
+    }
+
+}
@@ -0,0 +1,103 @@
+#include "gmredis/protocol/tape.h"
+#include <utility>
+
+namespace gmredis::protocol {
+
+    namespace {
+        RespValueView scalar_view(const Tape& tape, const TapeElement& element) {
+            switch (element.kind) {
+                case TapeKind::SimpleString:
+                    return SimpleStringView{tape.input.substr(element.offset, element.length)};
+                case TapeKind::SimpleError:
+                    return SimpleErrorView{tape.input.substr(element.offset, element.length)};
+                case TapeKind::BulkString:
+                    return BulkStringView{tape.input.substr(element.offset, element.length)};
+                case TapeKind::Integer:
+                    return Integer{element.integer};
+                case TapeKind::Array: {
+                    ArrayView array;
+                    array.values.reserve(element.length);
+                    return array;
+                }
+                case TapeKind::Null:
+                    break;
+            }
+            return Null{};
+        }
+    }
+
+    RespValueView Tape::value(std::size_t index) const {
+        if (!is_array(index)) {
+            return scalar_view(*this, elements[index]);
+        }
+
+        // Rebuild the tree in pre-order. Each array reserves its children up front, so
+        // pointers to open arrays stay valid while they fill up.
+        RespValueView root = scalar_view(*this, elements[index]);
+        std::vector<std::pair<ArrayView*, std::size_t>> open;
+        if (elements[index].length > 0) {
+            open.emplace_back(&std::get<ArrayView>(root), elements[index].length);
+        }
+
+        for (auto i = index + 1; i < elements[index].end; i++) {
+            const auto& element = elements[i];
+            auto& slot = open.back().first->values.emplace_back(scalar_view(*this, element));
+
+            if (element.kind == TapeKind::Array && element.length > 0) {
+                open.emplace_back(&std::get<ArrayView>(slot), element.length);
+                continue;
+            }
+            while (!open.empty() && open.back().first->values.size() == open.back().second) {
+                open.pop_back();
+            }
+        }
+        return root;
+    }
+
+    ArrayRef Tape::array(std::size_t index) const noexcept {
+        return ArrayRef(*this, index);
+    }
+
+    RespValueView ArrayRef::operator[](std::size_t i) const {
+        if (tape_ == nullptr) {
+            return view_->values[i];
+        }
+
+        const auto& array = tape_->elements[index_];
+        auto child = index_ + 1;
+        if (array.end == index_ + 1 + array.length) {
+            // No nested arrays: children are consecutive
+            child += i;
+        } else {
+            for (std::size_t skipped = 0; skipped < i; skipped++) {
+                child = tape_->next(child);
+            }
+        }
+        return tape_->value(child);
+    }
+
+    ArrayView ArrayRef::to_view() const {
+        ArrayView array;
+        array.values.reserve(size());
+        for (auto&& value : *this) {
+            array.values.push_back(std::move(value));
+        }
+        return array;
+    }
+
+    RespValueView ArrayRef::iterator::operator*() const {
+        if (array_->tape_ == nullptr) {
+            return array_->view_->values[position_];
+        }
+        return array_->tape_->value(element_);
+    }
+
+    ArrayRef::iterator& ArrayRef::iterator::operator++() noexcept {
+        if (array_->tape_ != nullptr) {
+            element_ = array_->tape_->next(element_);
+        }
+        position_++;
+        return *this;
+    }
+
+}
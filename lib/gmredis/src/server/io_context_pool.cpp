@@ -0,0 +1,81 @@
+#include "gmredis/server/io_context_pool.h"
+#include <spdlog/spdlog.h>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace gmredis::server {
+
+    IoContextPool::IoContextPool(std::size_t pool_size, bool pin_threads) : pin_threads_(pin_threads) {
+        if (pool_size == 0) {
+            pool_size = 1;
+        }
+
+        io_contexts_.reserve(pool_size);
+        work_guards_.reserve(pool_size);
+        for (std::size_t i = 0; i < pool_size; i++) {
+            // Each context is only ever run by one thread
+            io_contexts_.push_back(std::make_unique<asio::io_context>(1));
+            work_guards_.push_back(asio::make_work_guard(*io_contexts_.back()));
+        }
+    }
+
+    IoContextPool::~IoContextPool() {
+        stop();
+        join();
+    }
+
+    void IoContextPool::run() {
+        threads_.reserve(io_contexts_.size());
+        for (std::size_t i = 0; i < io_contexts_.size(); i++) {
+            threads_.emplace_back([this, i] {
+                if (pin_threads_ && !pin_current_thread(i)) {
+                    spdlog::warn("Unable to pin io thread {} to a CPU", i);
+                }
+                io_contexts_[i]->run();
+            });
+        }
+    }
+
+    void IoContextPool::stop() noexcept {
+        for (auto& guard : work_guards_) {
+            guard.reset();
+        }
+        for (auto& io_context : io_contexts_) {
+            io_context->stop();
+        }
+    }
+
+    void IoContextPool::join() {
+        for (auto& thread : threads_) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads_.clear();
+    }
+
+    asio::io_context& IoContextPool::next_io_context() noexcept {
+        auto index = next_.fetch_add(1, std::memory_order_relaxed) % io_contexts_.size();
+        return *io_contexts_[index];
+    }
+
+    bool pin_current_thread([[maybe_unused]] std::size_t cpu) noexcept {
+#if defined(__linux__)
+        auto cpu_count = std::thread::hardware_concurrency();
+        if (cpu_count == 0) {
+            return false;
+        }
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu % cpu_count, &cpu_set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+        return false;
+#endif
+    }
+
+}
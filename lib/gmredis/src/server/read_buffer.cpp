@@ -0,0 +1,71 @@
+#include "gmredis/server/read_buffer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace gmredis::server {
+
+    ReadBuffer::ReadBuffer(std::size_t initial_capacity)
+        : storage_(std::make_unique_for_overwrite<char[]>(std::max<std::size_t>(initial_capacity, 1))),
+          capacity_(std::max<std::size_t>(initial_capacity, 1)) {}
+
+    std::span<char> ReadBuffer::prepare(std::size_t min_size) {
+        if (capacity_ - write_pos_ < min_size) {
+            auto const readable = size();
+            if (capacity_ - readable >= min_size) {
+                // Enough room overall: slide the pending bytes to the front
+                std::memmove(storage_.get(), storage_.get() + read_pos_, readable);
+                read_pos_ = 0;
+                write_pos_ = readable;
+            } else {
+                reallocate(std::max(capacity_ * 2, readable + min_size));
+            }
+        }
+
+        return {storage_.get() + write_pos_, capacity_ - write_pos_};
+    }
+
+    void ReadBuffer::reserve(std::size_t size) {
+        if (capacity_ - read_pos_ >= size) {
+            return;
+        }
+        if (capacity_ >= size) {
+            auto const readable = this->size();
+            std::memmove(storage_.get(), storage_.get() + read_pos_, readable);
+            read_pos_ = 0;
+            write_pos_ = readable;
+            return;
+        }
+        reallocate(size);
+    }
+
+    void ReadBuffer::shrink(std::size_t capacity) {
+        auto const target = std::max({size(), capacity, std::size_t{1}});
+        if (capacity_ > target) {
+            reallocate(target);
+        }
+    }
+
+    void ReadBuffer::reallocate(std::size_t capacity) {
+        auto const readable = size();
+        auto new_storage = std::make_unique_for_overwrite<char[]>(capacity);
+        std::memcpy(new_storage.get(), storage_.get() + read_pos_, readable);
+        storage_ = std::move(new_storage);
+        capacity_ = capacity;
+        read_pos_ = 0;
+        write_pos_ = readable;
+    }
+
+    void ReadBuffer::commit(std::size_t n) noexcept {
+        write_pos_ = std::min(write_pos_ + n, capacity_);
+    }
+
+    void ReadBuffer::consume(std::size_t n) noexcept {
+        read_pos_ = std::min(read_pos_ + n, write_pos_);
+        if (read_pos_ == write_pos_) {
+            // Fully drained: rewinding is free and keeps the whole tail writable
+            read_pos_ = 0;
+            write_pos_ = 0;
+        }
+    }
+
+}
@@ -0,0 +1,68 @@
+#include "request_processor.h"
+#include "gmredis/protocol/parse.h"
+#include "gmredis/protocol/reply_sink.h"
+#include "gmredis/protocol/serialize.h"
+#include "gmredis/protocol/shared_replies.h"
+
+namespace gmredis::server {
+
+    BatchStatus RequestProcessor::process(ReadBuffer& input, protocol::ReplyBuffer& output) {
+        command::ClientScope client(client_address_);
+        std::size_t commands = 0;
+        if (stats_ == nullptr) {
+            return process_batch(input, output, commands);
+        }
+
+        // Input only shrinks while a batch runs, so the difference is what was consumed
+        auto const start = std::chrono::steady_clock::now();
+        auto const input_size = input.size();
+        auto const output_size = output.size();
+        auto const status = process_batch(input, output, commands);
+        stats_->record_input(input_size - input.size());
+        stats_->record_output(output.size() - output_size);
+
+        if (commands != 0) {
+            if (pending_.count == 0) {
+                pending_.since = start;
+            }
+            pending_.count += commands;
+        }
+        return status;
+    }
+
+    BatchStatus RequestProcessor::process_batch(ReadBuffer& input, protocol::ReplyBuffer& output, std::size_t& commands) {
+        while (commands < max_batch_commands_ && output.size() < max_batch_bytes_) {
+            auto parsed = parser_.parse_tape(input.data());
+
+            if (!parsed.has_value()) {
+                if (parsed.error() == protocol::ParseError::Incomplete) {
+                    if (parser_.pending_bulk_length() >= large_bulk_threshold_) {
+                        input.reserve(parser_.pending_bulk_end());
+                    }
+                    return BatchStatus::NeedInput;
+                }
+                protocol::serialize_to(output.bytes(), parsed.error() == protocol::ParseError::LimitExceeded
+                                                           ? protocol::shared::limit_exceeded_error
+                                                           : protocol::shared::protocol_error);
+                return BatchStatus::Close;
+            }
+
+            // The tape views input, so the request is executed before its bytes are consumed
+            if (const auto& tape = parser_.tape(); tape.is_array()) {
+                protocol::ReplySink sink(output);
+                dispatcher_->dispatch(tape.array(), sink);
+            } else {
+                protocol::serialize_to(output.bytes(), protocol::shared::expected_array_error);
+            }
+
+            input.consume(parser_.frame_size());
+            if (parser_.frame_size() >= large_bulk_threshold_) {
+                input.shrink(ReadBuffer::default_capacity);
+            }
+            commands++;
+        }
+
+        return BatchStatus::BatchFull;
+    }
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/protocol/incremental_parser.h"
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/server/read_buffer.h"
+#include "gmredis/server/server_config.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace gmredis::server {
+
+    /**
+     * @brief Outcome of RequestProcessor::process().
+     */
+    enum class BatchStatus {
+        /** Every complete request was executed; the rest of the input is a partial frame. */
+        NeedInput,
+        /** The batch limits were reached; complete requests may still be buffered. */
+        BatchFull,
+        /** A protocol error was answered; flush the output and close the connection. */
+        Close,
+    };
+
+    /**
+     * @brief Requests whose replies are in an output buffer but not yet written.
+     */
+    struct PendingReplies {
+        std::uint64_t count = 0;
+        /** When the oldest of them started to be processed. */
+        std::chrono::steady_clock::time_point since{};
+    };
+
+    /**
+     * @brief Turns buffered request bytes into buffered reply bytes.
+     *
+     * This is the transport-independent half of a connection: network backends own the socket
+     * and the buffers, the processor executes every complete request in the input and appends
+     * the replies to the output, stopping at the configured batch limits.
+     */
+    class RequestProcessor {
+    public:
+        RequestProcessor(std::shared_ptr<command::CommandDispatcher> dispatcher, const ServerConfig& config)
+            : dispatcher_(std::move(dispatcher)),
+              parser_(config.limits),
+              max_batch_commands_(config.max_batch_commands),
+              max_batch_bytes_(config.max_batch_bytes),
+              large_bulk_threshold_(config.large_bulk_threshold),
+              stats_(dispatcher_->stats()) {}
+
+        /**
+         * @brief Executes the complete requests in input, appending their replies to output.
+         *
+         * Parsed requests are consumed from input; a trailing partial frame is left in place
+         * and the parser keeps its progress through it for the next call. The bytes consumed
+         * and produced are added to the net input/output counters, and the executed requests
+         * to the pending replies (take_pending()). Replies may reference stored values, which
+         * stay alive until the backend clears output after writing it.
+         */
+        BatchStatus process(ReadBuffer& input, protocol::ReplyBuffer& output);
+
+        /**
+         * @brief The requests processed since the previous call, whose replies the backend is
+         *        about to write.
+         */
+        PendingReplies take_pending() noexcept {
+            return std::exchange(pending_, PendingReplies{});
+        }
+
+        /**
+         * @brief Records the latency of requests whose replies have been written, from the start
+         *        of the batch that parsed them until now.
+         */
+        void record_written(const PendingReplies& replies) noexcept {
+            if (stats_ != nullptr && replies.count != 0) {
+                auto const elapsed = std::chrono::steady_clock::now() - replies.since;
+                stats_->record_requests(
+                    static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                    replies.count);
+            }
+        }
+
+        /**
+         * @brief Bytes known to be still missing from the frame at the front of input, or 0
+         *        when the parser cannot tell (it is not inside a bulk payload).
+         *
+         * Backends read no more than this, so a buffer that was sized for a large frame is not
+         * grown again for the last few bytes.
+         */
+        [[nodiscard]] std::size_t missing_input(const ReadBuffer& input) const noexcept {
+            auto const end = parser_.pending_bulk_end();
+            return end > input.size() ? end - input.size() : 0;
+        }
+
+        /**
+         * @brief The peer address ("ip:port") reported for this connection's slow log entries.
+         */
+        void set_client_address(std::string address) { client_address_ = std::move(address); }
+
+        /**
+         * @brief Counts a newly accepted connection in the dispatcher's Stats, if any.
+         */
+        void record_connection() noexcept {
+            if (stats_ != nullptr) {
+                stats_->record_connection();
+            }
+        }
+
+    private:
+        BatchStatus process_batch(ReadBuffer& input, protocol::ReplyBuffer& output, std::size_t& commands);
+
+        std::shared_ptr<command::CommandDispatcher> dispatcher_;
+        protocol::IncrementalParser parser_;
+        std::size_t max_batch_commands_;
+        std::size_t max_batch_bytes_;
+        std::size_t large_bulk_threshold_;
+        /** Owned by the dispatcher; null when statistics are off. */
+        command::Stats* stats_;
+        PendingReplies pending_;
+        std::string client_address_;
+    };
+
+}
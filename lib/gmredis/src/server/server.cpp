@@ -0,0 +1,217 @@
+#include "gmredis/server/server.h"
+#include "session.h"
+#include <atomic>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <thread>
+
+#if defined(GMREDIS_HAS_IO_URING)
+#include "uring_server.h"
+#else
+namespace gmredis::server {
+    class UringServer {};
+}
+#endif
+
+namespace gmredis::server {
+    namespace {
+#if defined(SO_REUSEPORT)
+        using reuse_port = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+        constexpr bool reuse_port_supported = true;
+#else
+        constexpr bool reuse_port_supported = false;
+#endif
+    }
+
+    std::size_t effective_io_threads(const ServerConfig& config) noexcept {
+        if (config.io_threads != 0) {
+            return config.io_threads;
+        }
+        auto hardware_threads = std::thread::hardware_concurrency();
+        return hardware_threads == 0 ? 1 : hardware_threads;
+    }
+
+    std::string_view to_string(NetworkBackend backend) noexcept {
+        switch (backend) {
+            case NetworkBackend::Epoll:
+                return "epoll";
+            case NetworkBackend::IoUring:
+                return "io_uring";
+        }
+        return "unknown";
+    }
+
+    Server::Server(ServerConfig config, std::shared_ptr<command::CommandDispatcher> dispatcher)
+        : config_(std::move(config)),
+          dispatcher_(std::move(dispatcher)),
+          pool_(effective_io_threads(config_), config_.pin_threads) {}
+
+    Server::~Server() {
+        stop();
+        wait();
+    }
+
+    std::expected<void, std::error_code> Server::start() {
+        std::error_code ec;
+        auto address = asio::ip::make_address(config_.bind_address, ec);
+        if (ec) {
+            return std::unexpected(ec);
+        }
+
+        if (config_.backend == NetworkBackend::IoUring &&
+            start_io_uring(asio::ip::tcp::endpoint(address, config_.port))) {
+            return {};
+        }
+
+        shared_acceptor_ = !(config_.reuse_port && reuse_port_supported) || pool_.size() == 1;
+
+        // The first acceptor resolves an ephemeral port; the rest must share it.
+        asio::ip::tcp::endpoint endpoint(address, config_.port);
+        auto opened = open_acceptor(pool_.get_io_context(0), endpoint);
+        if (!opened) {
+            return opened;
+        }
+        bound_port_ = acceptors_.front()->local_endpoint().port();
+        endpoint.port(bound_port_);
+
+        if (!shared_acceptor_) {
+            for (std::size_t i = 1; i < pool_.size(); i++) {
+                opened = open_acceptor(pool_.get_io_context(i), endpoint);
+                if (!opened) {
+                    acceptors_.clear();
+                    return opened;
+                }
+            }
+        }
+
+        for (auto& acceptor : acceptors_) {
+            do_accept(*acceptor);
+        }
+
+        spdlog::info("Listening on {}:{} with {} io threads ({})", config_.bind_address, bound_port_,
+                     pool_.size(), shared_acceptor_ ? "shared acceptor" : "SO_REUSEPORT");
+        pool_.run();
+        return {};
+    }
+
+    void Server::stop() noexcept {
+#if defined(GMREDIS_HAS_IO_URING)
+        if (uring_) {
+            uring_->stop();
+        }
+#endif
+        if (stopping_.exchange(true)) {
+            return;
+        }
+        if (acceptors_.empty()) {
+            pool_.stop();
+            return;
+        }
+
+        // Stopping the pool abandons pending handlers, so it waits until the last close has run
+        auto remaining = std::make_shared<std::atomic<std::size_t>>(acceptors_.size());
+        for (auto& acceptor : acceptors_) {
+            asio::post(acceptor->get_executor(), [this, &acceptor = *acceptor, remaining] {
+                std::error_code ignored;
+                acceptor.close(ignored);
+                if (remaining->fetch_sub(1) == 1) {
+                    pool_.stop();
+                }
+            });
+        }
+    }
+
+    void Server::wait() {
+#if defined(GMREDIS_HAS_IO_URING)
+        if (uring_) {
+            uring_->wait();
+        }
+#endif
+        pool_.join();
+    }
+
+    bool Server::start_io_uring([[maybe_unused]] const asio::ip::tcp::endpoint& endpoint) {
+#if defined(GMREDIS_HAS_IO_URING)
+        if (!UringServer::is_supported()) {
+            spdlog::warn("io_uring is not supported by this kernel, falling back to epoll");
+            return false;
+        }
+
+        uring_ = std::make_unique<UringServer>(config_, dispatcher_);
+        auto started = uring_->start(endpoint);
+        if (!started) {
+            spdlog::warn("io_uring backend failed to start ({}), falling back to epoll", started.error().message());
+            uring_.reset();
+            return false;
+        }
+
+        bound_port_ = *started;
+        backend_ = NetworkBackend::IoUring;
+        spdlog::info("Listening on {}:{} with {} io_uring workers", config_.bind_address, bound_port_,
+                     effective_io_threads(config_));
+        return true;
+#else
+        spdlog::warn("gmredis was built without io_uring support, falling back to epoll");
+        return false;
+#endif
+    }
+
+    std::expected<void, std::error_code> Server::open_acceptor(asio::io_context& io_context,
+                                                               const asio::ip::tcp::endpoint& endpoint) {
+        auto acceptor = std::make_unique<asio::ip::tcp::acceptor>(io_context);
+
+        std::error_code ec;
+        if (acceptor->open(endpoint.protocol(), ec); ec) {
+            return std::unexpected(ec);
+        }
+        if (acceptor->set_option(asio::socket_base::reuse_address(true), ec); ec) {
+            return std::unexpected(ec);
+        }
+#if defined(SO_REUSEPORT)
+        if (!shared_acceptor_) {
+            if (acceptor->set_option(reuse_port(true), ec); ec) {
+                return std::unexpected(ec);
+            }
+        }
+#endif
+        if (acceptor->bind(endpoint, ec); ec) {
+            return std::unexpected(ec);
+        }
+        if (acceptor->listen(asio::socket_base::max_listen_connections, ec); ec) {
+            return std::unexpected(ec);
+        }
+
+        acceptors_.push_back(std::move(acceptor));
+        return {};
+    }
+
+    void Server::do_accept(asio::ip::tcp::acceptor& acceptor) {
+        auto on_accept = [this, &acceptor](std::error_code ec, asio::ip::tcp::socket socket) {
+            if (ec == asio::error::operation_aborted || !acceptor.is_open()) {
+                return;
+            }
+
+            if (!ec) {
+                std::error_code ignored;
+                socket.set_option(asio::ip::tcp::no_delay(true), ignored);
+                auto const peer = socket.remote_endpoint(ignored);
+                spdlog::debug("New client connected from {}", peer.address().to_string());
+                RequestProcessor processor(dispatcher_, config_);
+                processor.record_connection();
+                processor.set_client_address(peer.address().to_string() + ":" + std::to_string(peer.port()));
+                Session::start(std::move(socket), std::move(processor));
+            } else {
+                spdlog::warn("Accept error: {}", ec.message());
+            }
+
+            do_accept(acceptor);
+        };
+
+        if (shared_acceptor_) {
+            acceptor.async_accept(pool_.next_io_context(), std::move(on_accept));
+        } else {
+            acceptor.async_accept(std::move(on_accept));
+        }
+    }
+
+}
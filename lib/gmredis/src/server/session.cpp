@@ -0,0 +1,80 @@
+#include "session.h"
+#include <algorithm>
+#include <new>
+#include <span>
+#include <spdlog/spdlog.h>
+
+namespace gmredis::server {
+
+    namespace {
+        asio::awaitable<void> serve(asio::ip::tcp::socket socket, RequestProcessor processor) {
+            Session session(std::move(socket), std::move(processor));
+            co_await session.run();
+        }
+    }
+
+    void* HandlerMemory::allocate(std::size_t size) {
+        if (!in_use_ && size <= storage_.size()) {
+            in_use_ = true;
+            return storage_.data();
+        }
+        return ::operator new(size);
+    }
+
+    void HandlerMemory::deallocate(void* pointer) noexcept {
+        if (pointer == storage_.data()) {
+            in_use_ = false;
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    void Session::start(asio::ip::tcp::socket socket, RequestProcessor processor) {
+        auto executor = socket.get_executor();
+        asio::co_spawn(executor, serve(std::move(socket), std::move(processor)), asio::detached);
+    }
+
+    asio::awaitable<void> Session::run() {
+        std::error_code ec;
+        for (;;) {
+            auto status = processor_.process(read_buffer_, write_buffer_);
+
+            if (!write_buffer_.empty()) {
+                auto const replies = processor_.take_pending();
+                write_chunks_.clear();
+                write_buffer_.for_each_chunk([this](std::string_view chunk) { write_chunks_.push_back(asio::buffer(chunk)); });
+                // A span rather than the vector, which the write operation would copy
+                co_await asio::async_write(socket_, std::span<const asio::const_buffer>(write_chunks_), use_handler_memory(ec));
+                if (ec) {
+                    spdlog::debug("Write error: {}", ec.message());
+                    co_return;
+                }
+                processor_.record_written(replies);
+                // clear() keeps the capacity, so steady-state batches do not reallocate, and
+                // releases the stored values the replies referenced
+                write_buffer_.clear();
+            }
+
+            if (status == BatchStatus::Close) {
+                std::error_code ignored;
+                socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ignored);
+                co_return;
+            }
+            if (status == BatchStatus::BatchFull) {
+                continue;
+            }
+
+            auto const missing = processor_.missing_input(read_buffer_);
+            auto buffer = read_buffer_.prepare(missing != 0 ? std::min(missing, min_read_size) : min_read_size);
+            auto length = co_await socket_.async_read_some(asio::buffer(buffer.data(), buffer.size()), use_handler_memory(ec));
+            if (ec) {
+                if (ec != asio::error::eof && ec != asio::error::operation_aborted) {
+                    spdlog::debug("Read error: {}", ec.message());
+                }
+                co_return;
+            }
+            read_buffer_.commit(length);
+        }
+    }
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "request_processor.h"
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/server/read_buffer.h"
+#include <array>
+#include <asio.hpp>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace gmredis::server {
+
+    /**
+     * @brief Per-session storage reused for the state of every asynchronous operation.
+     *
+     * A session waits on one socket operation at a time, so a single block covers every read
+     * and write it issues. Requests that do not fit, or arrive while the block is taken, fall
+     * back to the heap.
+     */
+    class HandlerMemory {
+    public:
+        HandlerMemory() = default;
+
+        HandlerMemory(const HandlerMemory&) = delete;
+        HandlerMemory& operator=(const HandlerMemory&) = delete;
+
+        void* allocate(std::size_t size);
+        void deallocate(void* pointer) noexcept;
+
+        static constexpr std::size_t block_size = 1024;
+
+    private:
+        alignas(std::max_align_t) std::array<std::byte, block_size> storage_{};
+        bool in_use_ = false;
+    };
+
+    /**
+     * @brief Allocator handing out HandlerMemory; bound to the completion tokens of a session.
+     */
+    template <typename T>
+    class HandlerAllocator {
+    public:
+        using value_type = T;
+
+        explicit HandlerAllocator(HandlerMemory& memory) noexcept : memory_(&memory) {}
+
+        template <typename U>
+        HandlerAllocator(const HandlerAllocator<U>& other) noexcept : memory_(other.memory_) {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(memory_->allocate(sizeof(T) * n));
+        }
+
+        void deallocate(T* pointer, std::size_t /*n*/) noexcept {
+            memory_->deallocate(pointer);
+        }
+
+        template <typename U>
+        bool operator==(const HandlerAllocator<U>& other) const noexcept {
+            return memory_ == other.memory_;
+        }
+
+    private:
+        template <typename>
+        friend class HandlerAllocator;
+
+        HandlerMemory* memory_;
+    };
+
+    /**
+     * @brief A single client connection on the asio (epoll) backend, run as a coroutine on the
+     *        io_context of its socket.
+     *
+     * Bytes are read into a ReadBuffer; every complete request found in it is executed and
+     * its reply appended to one output buffer, which is then flushed with a single gather
+     * write of its bytes and the stored values it references.
+     * Pipelined clients therefore cost one read and one write per batch rather than per
+     * command. A batch ends when the buffered input runs out or when it reaches
+     * ServerConfig::max_batch_commands / max_batch_bytes, bounding the latency of the first
+     * reply. A protocol error is answered with an error reply after which the connection is
+     * closed.
+     *
+     * The session lives in its coroutine frame and all socket operations allocate from its
+     * HandlerMemory, so once the buffers have grown to the working size the I/O loop itself
+     * performs no heap allocations.
+     */
+    class Session {
+    public:
+        Session(asio::ip::tcp::socket socket, RequestProcessor processor)
+            : socket_(std::move(socket)), processor_(std::move(processor)) {}
+
+        /**
+         * @brief Spawns a session for socket on the socket's executor.
+         */
+        static void start(asio::ip::tcp::socket socket, RequestProcessor processor);
+
+        /**
+         * @brief Serves the connection until the peer disconnects or a protocol error occurs.
+         */
+        asio::awaitable<void> run();
+
+    private:
+        auto use_handler_memory(std::error_code& ec) {
+            return asio::bind_allocator(HandlerAllocator<std::byte>(handler_memory_),
+                                        asio::redirect_error(asio::use_awaitable, ec));
+        }
+
+        static constexpr std::size_t min_read_size = 4096;
+
+        asio::ip::tcp::socket socket_;
+        RequestProcessor processor_;
+        ReadBuffer read_buffer_;
+        protocol::ReplyBuffer write_buffer_;
+        /** The pieces of write_buffer_ being written; reused so writes do not allocate. */
+        std::vector<asio::const_buffer> write_chunks_;
+        HandlerMemory handler_memory_;
+    };
+
+}
@@ -0,0 +1,513 @@
+#include "uring_server.h"
+#include "gmredis/server/io_context_pool.h"
+#include <spdlog/spdlog.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace gmredis::server {
+    namespace {
+        std::error_code last_error() noexcept {
+            return {errno, std::system_category()};
+        }
+
+        // Multishot recv landed in 6.0; provided buffer rings in 5.19.
+        bool kernel_at_least(int major, int minor) noexcept {
+            utsname name{};
+            if (uname(&name) != 0) {
+                return false;
+            }
+            int kernel_major = 0;
+            int kernel_minor = 0;
+            if (std::sscanf(name.release, "%d.%d", &kernel_major, &kernel_minor) != 2) {
+                return false;
+            }
+            return kernel_major > major || (kernel_major == major && kernel_minor >= minor);
+        }
+
+        std::expected<int, std::error_code> open_listener(const asio::ip::tcp::endpoint& endpoint) {
+            int fd = ::socket(endpoint.protocol().family(), SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (fd < 0) {
+                return std::unexpected(last_error());
+            }
+
+            int enable = 1;
+            if (::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) != 0 ||
+                ::setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0 ||
+                ::bind(fd, endpoint.data(), static_cast<socklen_t>(endpoint.size())) != 0 ||
+                ::listen(fd, SOMAXCONN) != 0) {
+                auto error = last_error();
+                ::close(fd);
+                return std::unexpected(error);
+            }
+
+            return fd;
+        }
+
+        unsigned short local_port(int fd) noexcept {
+            sockaddr_storage address{};
+            socklen_t size = sizeof(address);
+            if (::getsockname(fd, reinterpret_cast<sockaddr*>(&address), &size) != 0) {
+                return 0;
+            }
+            if (address.ss_family == AF_INET6) {
+                return ntohs(reinterpret_cast<sockaddr_in6*>(&address)->sin6_port);
+            }
+            return ntohs(reinterpret_cast<sockaddr_in*>(&address)->sin_port);
+        }
+
+        /** "ip:port" of the peer of fd, or empty if it cannot be determined. */
+        std::string peer_address(int fd) {
+            asio::ip::tcp::endpoint endpoint;
+            socklen_t size = static_cast<socklen_t>(endpoint.capacity());
+            if (::getpeername(fd, endpoint.data(), &size) != 0) {
+                return {};
+            }
+            endpoint.resize(size);
+            return endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+        }
+    }
+
+    // ---------------------------------------------------------------- UringWorker
+
+    UringWorker::UringWorker(int listen_fd, RequestProcessor processor, std::size_t max_output_bytes)
+        : listen_fd_(listen_fd), processor_(std::move(processor)), max_output_bytes_(max_output_bytes) {}
+
+    UringWorker::~UringWorker() {
+        for (auto& [fd, connection] : connections_) {
+            ::close(fd);
+        }
+        if (buffer_ring_ != nullptr) {
+            io_uring_free_buf_ring(&ring_, buffer_ring_, buffer_count, buffer_group);
+        }
+        if (ring_initialized_) {
+            io_uring_queue_exit(&ring_);
+        }
+        if (wake_fd_ >= 0) {
+            ::close(wake_fd_);
+        }
+    }
+
+    std::expected<void, std::error_code> UringWorker::init() {
+        wake_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (wake_fd_ < 0) {
+            return std::unexpected(last_error());
+        }
+
+        io_uring_params params{};
+        params.flags = IORING_SETUP_COOP_TASKRUN;
+        int ret = io_uring_queue_init_params(ring_entries, &ring_, &params);
+        if (ret == -EINVAL) {
+            params = {};
+            ret = io_uring_queue_init_params(ring_entries, &ring_, &params);
+        }
+        if (ret < 0) {
+            return std::unexpected(std::error_code(-ret, std::system_category()));
+        }
+        ring_initialized_ = true;
+
+        buffer_ring_ = io_uring_setup_buf_ring(&ring_, buffer_count, buffer_group, 0, &ret);
+        if (buffer_ring_ == nullptr) {
+            return std::unexpected(std::error_code(-ret, std::system_category()));
+        }
+
+        buffers_ = std::make_unique_for_overwrite<char[]>(std::size_t{buffer_count} * buffer_size);
+        for (unsigned i = 0; i < buffer_count; i++) {
+            io_uring_buf_ring_add(buffer_ring_, buffers_.get() + std::size_t{i} * buffer_size, buffer_size,
+                                  static_cast<unsigned short>(i), io_uring_buf_ring_mask(buffer_count),
+                                  static_cast<int>(i));
+        }
+        io_uring_buf_ring_advance(buffer_ring_, static_cast<int>(buffer_count));
+
+        return {};
+    }
+
+    void UringWorker::run() {
+        arm_accept();
+        arm_wake();
+
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            int ret = io_uring_submit_and_wait(&ring_, 1);
+            if (ret < 0 && ret != -EINTR && ret != -EAGAIN && ret != -EBUSY) {
+                spdlog::error("io_uring_submit_and_wait failed: {}", std::strerror(-ret));
+                break;
+            }
+
+            unsigned head = 0;
+            unsigned seen = 0;
+            io_uring_cqe* cqe = nullptr;
+            io_uring_for_each_cqe(&ring_, head, cqe) {
+                handle_completion(*cqe);
+                seen++;
+            }
+            io_uring_cq_advance(&ring_, seen);
+
+            // All replies produced by this round of completions go out with the next submit
+            flush_sends();
+        }
+    }
+
+    void UringWorker::stop() noexcept {
+        stopping_.store(true, std::memory_order_relaxed);
+        std::uint64_t one = 1;
+        [[maybe_unused]] auto written = ::write(wake_fd_, &one, sizeof(one));
+    }
+
+    std::uint64_t UringWorker::encode(Op op, Connection* connection) noexcept {
+        return reinterpret_cast<std::uint64_t>(connection) | static_cast<std::uint64_t>(op);
+    }
+
+    io_uring_sqe* UringWorker::get_sqe() {
+        auto* sqe = io_uring_get_sqe(&ring_);
+        while (sqe == nullptr) {
+            // Submission queue full: hand what we have to the kernel and retry
+            io_uring_submit(&ring_);
+            sqe = io_uring_get_sqe(&ring_);
+        }
+        return sqe;
+    }
+
+    void UringWorker::arm_accept() {
+        auto* sqe = get_sqe();
+        io_uring_prep_multishot_accept(sqe, listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        io_uring_sqe_set_data64(sqe, encode(Op::Accept));
+    }
+
+    void UringWorker::arm_recv(Connection& connection) {
+        auto* sqe = get_sqe();
+        io_uring_prep_recv_multishot(sqe, connection.fd, nullptr, 0, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = buffer_group;
+        io_uring_sqe_set_data64(sqe, encode(Op::Recv, &connection));
+        connection.recv_armed = true;
+    }
+
+    void UringWorker::pause_recv(Connection& connection) {
+        if (!connection.recv_armed || connection.recv_cancelling) {
+            return;
+        }
+        // A multishot recv keeps completing as long as data arrives, so it has to be cancelled;
+        // its final completion arrives without IORING_CQE_F_MORE
+        auto* sqe = get_sqe();
+        io_uring_prep_cancel64(sqe, encode(Op::Recv, &connection), 0);
+        io_uring_sqe_set_data64(sqe, encode(Op::Cancel));
+        connection.recv_cancelling = true;
+    }
+
+    void UringWorker::arm_wake() {
+        auto* sqe = get_sqe();
+        io_uring_prep_read(sqe, wake_fd_, &wake_value_, sizeof(wake_value_), 0);
+        io_uring_sqe_set_data64(sqe, encode(Op::Wake));
+    }
+
+    void UringWorker::submit_send(Connection& connection) {
+        auto* sqe = get_sqe();
+        const auto& bytes = connection.sending.bytes();
+        if (!connection.sending.has_references()) {
+            io_uring_prep_send(sqe, connection.fd, bytes.data() + connection.send_offset,
+                               bytes.size() - connection.send_offset, MSG_NOSIGNAL);
+        } else {
+            // Gather the unsent remainder; the iovecs live in the connection until completion
+            connection.send_chunks.clear();
+            auto skip = connection.send_offset;
+            connection.sending.for_each_chunk([&connection, &skip](std::string_view chunk) {
+                if (skip >= chunk.size()) {
+                    skip -= chunk.size();
+                    return;
+                }
+                chunk.remove_prefix(skip);
+                skip = 0;
+                if (connection.send_chunks.size() < max_send_chunks) {
+                    connection.send_chunks.push_back({const_cast<char*>(chunk.data()), chunk.size()});
+                }
+            });
+            connection.send_message = {};
+            connection.send_message.msg_iov = connection.send_chunks.data();
+            connection.send_message.msg_iovlen = connection.send_chunks.size();
+            io_uring_prep_sendmsg(sqe, connection.fd, &connection.send_message, MSG_NOSIGNAL);
+        }
+        io_uring_sqe_set_data64(sqe, encode(Op::Send, &connection));
+        connection.send_in_flight = true;
+    }
+
+    void UringWorker::handle_completion(const io_uring_cqe& cqe) {
+        auto data = io_uring_cqe_get_data64(&cqe);
+        auto op = static_cast<Op>(data & op_mask);
+        auto* connection = reinterpret_cast<Connection*>(data & ~op_mask);
+
+        switch (op) {
+            case Op::Accept:
+                on_accept(cqe);
+                break;
+            case Op::Recv:
+                on_recv(*connection, cqe);
+                break;
+            case Op::Send:
+                on_send(*connection, cqe);
+                break;
+            case Op::Wake:
+            case Op::Cancel:
+                break;
+        }
+    }
+
+    void UringWorker::on_accept(const io_uring_cqe& cqe) {
+        if (cqe.res >= 0) {
+            int enable = 1;
+            ::setsockopt(cqe.res, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+            processor_.record_connection();
+            auto connection = std::make_unique<Connection>(cqe.res, processor_);
+            connection->processor.set_client_address(peer_address(cqe.res));
+            arm_recv(*connection);
+            connections_.emplace(cqe.res, std::move(connection));
+        } else if (!stopping_.load(std::memory_order_relaxed)) {
+            spdlog::warn("Accept error: {}", std::strerror(-cqe.res));
+        }
+
+        if ((cqe.flags & IORING_CQE_F_MORE) == 0 && !stopping_.load(std::memory_order_relaxed)) {
+            arm_accept();
+        }
+    }
+
+    void UringWorker::on_recv(Connection& connection, const io_uring_cqe& cqe) {
+        if ((cqe.flags & IORING_CQE_F_MORE) == 0) {
+            connection.recv_armed = false;
+            connection.recv_cancelling = false;
+        }
+
+        if (cqe.res > 0 && (cqe.flags & IORING_CQE_F_BUFFER) != 0) {
+            auto buffer_id = static_cast<unsigned short>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+            auto length = static_cast<std::size_t>(cqe.res);
+            if (!connection.closing) {
+                auto tail = connection.input.prepare(length);
+                std::memcpy(tail.data(), buffers_.get() + std::size_t{buffer_id} * buffer_size, length);
+                connection.input.commit(length);
+            }
+            recycle_buffer(buffer_id);
+
+            // Input received while backpressured waits in the buffer for on_send()
+            if (!connection.closing && !backpressured(connection)) {
+                process(connection);
+            }
+        } else if (cqe.res == -ENOBUFS || cqe.res == -ECANCELED) {
+            // The buffer ring ran dry; buffers are recycled as soon as they are copied out.
+            // Or pause_recv() cancelled the recv, and on_send() re-arms it
+        } else if (cqe.res <= 0) {
+            begin_close(connection);
+        }
+
+        if (connection.closing) {
+            if (!connection.recv_armed) {
+                maybe_destroy(connection);
+            }
+        } else if (backpressured(connection)) {
+            pause_recv(connection);
+        } else if (!connection.recv_armed) {
+            arm_recv(connection);
+        }
+    }
+
+    void UringWorker::on_send(Connection& connection, const io_uring_cqe& cqe) {
+        connection.send_in_flight = false;
+
+        if (cqe.res < 0) {
+            begin_close(connection);
+            maybe_destroy(connection);
+            return;
+        }
+
+        connection.send_offset += static_cast<std::size_t>(cqe.res);
+        if (connection.send_offset < connection.sending.size()) {
+            // Short send: push the remainder
+            submit_send(connection);
+            return;
+        }
+
+        connection.sending.clear();
+        connection.send_offset = 0;
+        connection.processor.record_written(connection.sending_replies);
+
+        if (connection.close_after_send && connection.output.empty()) {
+            begin_close(connection);
+            maybe_destroy(connection);
+            return;
+        }
+
+        // A full batch, or input received while backpressured, may have left complete
+        // requests behind
+        if (!connection.closing) {
+            process(connection);
+        }
+        if (!connection.output.empty()) {
+            queue_send(connection);
+        }
+        if (!connection.closing && !connection.recv_armed && !backpressured(connection)) {
+            arm_recv(connection);
+        }
+        maybe_destroy(connection);
+    }
+
+    void UringWorker::process(Connection& connection) {
+        if (connection.close_after_send) {
+            return;
+        }
+
+        auto status = connection.processor.process(connection.input, connection.output);
+        if (status == BatchStatus::Close) {
+            connection.close_after_send = true;
+        }
+        if (!connection.output.empty()) {
+            queue_send(connection);
+        }
+    }
+
+    bool UringWorker::backpressured(const Connection& connection) const noexcept {
+        return connection.send_in_flight || connection.output.size() >= max_output_bytes_;
+    }
+
+    void UringWorker::queue_send(Connection& connection) {
+        if (!connection.queued) {
+            connection.queued = true;
+            send_queue_.push_back(&connection);
+        }
+    }
+
+    void UringWorker::flush_sends() {
+        for (auto* connection : send_queue_) {
+            connection->queued = false;
+            if (connection->closing) {
+                maybe_destroy(*connection);
+                continue;
+            }
+            if (connection->send_in_flight || connection->output.empty()) {
+                continue;
+            }
+            std::swap(connection->sending, connection->output);
+            connection->sending_replies = connection->processor.take_pending();
+            connection->send_offset = 0;
+            submit_send(*connection);
+        }
+        send_queue_.clear();
+    }
+
+    void UringWorker::recycle_buffer(unsigned short buffer_id) noexcept {
+        io_uring_buf_ring_add(buffer_ring_, buffers_.get() + std::size_t{buffer_id} * buffer_size, buffer_size,
+                              buffer_id, io_uring_buf_ring_mask(buffer_count), 0);
+        io_uring_buf_ring_advance(buffer_ring_, 1);
+    }
+
+    void UringWorker::begin_close(Connection& connection) noexcept {
+        if (!connection.closing) {
+            connection.closing = true;
+            // Terminates the multishot recv; the connection is freed once nothing is in flight
+            ::shutdown(connection.fd, SHUT_RDWR);
+        }
+    }
+
+    void UringWorker::maybe_destroy(Connection& connection) {
+        if (!connection.closing || connection.recv_armed || connection.send_in_flight || connection.queued) {
+            return;
+        }
+        int fd = connection.fd;
+        ::close(fd);
+        connections_.erase(fd);
+    }
+
+    // ---------------------------------------------------------------- UringServer
+
+    UringServer::UringServer(const ServerConfig& config, std::shared_ptr<command::CommandDispatcher> dispatcher)
+        : config_(config), dispatcher_(std::move(dispatcher)) {}
+
+    UringServer::~UringServer() {
+        stop();
+        wait();
+        for (int fd : listen_fds_) {
+            ::close(fd);
+        }
+    }
+
+    bool UringServer::is_supported() noexcept {
+        if (!kernel_at_least(6, 0)) {
+            return false;
+        }
+
+        io_uring ring{};
+        if (io_uring_queue_init(8, &ring, 0) < 0) {
+            return false;
+        }
+
+        bool supported = false;
+        if (auto* probe = io_uring_get_probe_ring(&ring); probe != nullptr) {
+            supported = io_uring_opcode_supported(probe, IORING_OP_ACCEPT) &&
+                        io_uring_opcode_supported(probe, IORING_OP_RECV) &&
+                        io_uring_opcode_supported(probe, IORING_OP_SEND);
+            io_uring_free_probe(probe);
+        }
+
+        if (supported) {
+            int ret = 0;
+            auto* buffer_ring = io_uring_setup_buf_ring(&ring, 8, 0, 0, &ret);
+            supported = buffer_ring != nullptr;
+            if (buffer_ring != nullptr) {
+                io_uring_free_buf_ring(&ring, buffer_ring, 8, 0);
+            }
+        }
+
+        io_uring_queue_exit(&ring);
+        return supported;
+    }
+
+    std::expected<unsigned short, std::error_code> UringServer::start(asio::ip::tcp::endpoint endpoint) {
+        auto worker_count = effective_io_threads(config_);
+
+        for (std::size_t i = 0; i < worker_count; i++) {
+            auto listener = open_listener(endpoint);
+            if (!listener) {
+                return std::unexpected(listener.error());
+            }
+            listen_fds_.push_back(*listener);
+            // The first listener resolves an ephemeral port; the rest must share it
+            endpoint.port(local_port(*listener));
+
+            auto worker = std::make_unique<UringWorker>(*listener, RequestProcessor(dispatcher_, config_), config_.max_batch_bytes);
+            if (auto initialized = worker->init(); !initialized) {
+                return std::unexpected(initialized.error());
+            }
+            workers_.push_back(std::move(worker));
+        }
+
+        threads_.reserve(workers_.size());
+        for (std::size_t i = 0; i < workers_.size(); i++) {
+            threads_.emplace_back([this, i] {
+                if (config_.pin_threads && !pin_current_thread(i)) {
+                    spdlog::warn("Unable to pin io_uring worker {} to a CPU", i);
+                }
+                workers_[i]->run();
+            });
+        }
+
+        return endpoint.port();
+    }
+
+    void UringServer::stop() noexcept {
+        for (auto& worker : workers_) {
+            worker->stop();
+        }
+    }
+
+    void UringServer::wait() {
+        for (auto& thread : threads_) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads_.clear();
+    }
+
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "request_processor.h"
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/server/read_buffer.h"
+#include "gmredis/server/server_config.h"
+#include <asio.hpp>
+#include <liburing.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace gmredis::server {
+
+    /**
+     * @brief One io_uring event loop: a ring, a SO_REUSEPORT listener and its connections.
+     *
+     * - A single multishot accept stays armed on the listener.
+     * - Each connection has one multishot recv armed, drawing from a provided buffer ring, so
+     *   there is no per-read submission. Received bytes are appended to the connection's
+     *   ReadBuffer and the buffer is returned to the ring immediately.
+     * - Replies produced while handling a batch of completions are queued and all sends are
+     *   submitted together with the next io_uring_submit_and_wait().
+     * - While a connection has a send in flight or max_output_bytes of unsent replies, it
+     *   executes no requests and its recv is cancelled; the send completion resumes both. A
+     *   client that pipelines without reading its replies therefore cannot grow its buffers
+     *   without bound.
+     */
+    class UringWorker {
+    public:
+        /**
+         * @param max_output_bytes Unsent reply bytes at which a connection stops reading
+         *                         (ServerConfig::max_batch_bytes)
+         */
+        UringWorker(int listen_fd, RequestProcessor processor, std::size_t max_output_bytes);
+        ~UringWorker();
+
+        UringWorker(const UringWorker&) = delete;
+        UringWorker& operator=(const UringWorker&) = delete;
+
+        /**
+         * @brief Creates the ring, the provided buffer ring and the wake-up eventfd.
+         */
+        std::expected<void, std::error_code> init();
+
+        /**
+         * @brief Runs the event loop until stop() is called.
+         */
+        void run();
+
+        /**
+         * @brief Wakes the event loop and makes run() return. Safe to call from any thread.
+         */
+        void stop() noexcept;
+
+    private:
+        struct Connection {
+            Connection(int socket_fd, RequestProcessor request_processor)
+                : fd(socket_fd), processor(std::move(request_processor)) {}
+
+            int fd;
+            /** Holds the parser progress through this connection's partial frame. */
+            RequestProcessor processor;
+            ReadBuffer input;
+            /** Replies produced since the last send was submitted. */
+            protocol::ReplyBuffer output;
+            /**
+             * Replies owned by the kernel until the in-flight send completes, along with the
+             * stored values they reference.
+             */
+            protocol::ReplyBuffer sending;
+            /** The sendmsg() arguments for a sending buffer with references. */
+            std::vector<iovec> send_chunks;
+            msghdr send_message{};
+            /** The requests answered by sending, for the request latency histogram. */
+            PendingReplies sending_replies;
+            std::size_t send_offset = 0;
+            bool send_in_flight = false;
+            bool recv_armed = false;
+            /** A cancel of the armed recv has been submitted. */
+            bool recv_cancelling = false;
+            bool queued = false;
+            bool close_after_send = false;
+            bool closing = false;
+        };
+
+        enum class Op : std::uint64_t { Accept = 1, Recv = 2, Send = 3, Wake = 4, Cancel = 5 };
+
+        static constexpr unsigned ring_entries = 4096;
+        static constexpr unsigned buffer_count = 1024;
+        static constexpr unsigned buffer_size = 16 * 1024;
+        static constexpr int buffer_group = 0;
+        static constexpr std::uint64_t op_mask = 0x7;
+        /** Linux's limit on the iovecs of one sendmsg(); a short send picks up the rest. */
+        static constexpr std::size_t max_send_chunks = 1024;
+
+        static std::uint64_t encode(Op op, Connection* connection = nullptr) noexcept;
+
+        io_uring_sqe* get_sqe();
+        void arm_accept();
+        void arm_recv(Connection& connection);
+        /** Cancels the armed recv of a connection that has to wait for its replies to drain. */
+        void pause_recv(Connection& connection);
+        void arm_wake();
+        void submit_send(Connection& connection);
+
+        void handle_completion(const io_uring_cqe& cqe);
+        void on_accept(const io_uring_cqe& cqe);
+        void on_recv(Connection& connection, const io_uring_cqe& cqe);
+        void on_send(Connection& connection, const io_uring_cqe& cqe);
+
+        void process(Connection& connection);
+        /** Whether the connection must not take more input until a send completes. */
+        [[nodiscard]] bool backpressured(const Connection& connection) const noexcept;
+        void queue_send(Connection& connection);
+        void flush_sends();
+        void recycle_buffer(unsigned short buffer_id) noexcept;
+        void begin_close(Connection& connection) noexcept;
+        void maybe_destroy(Connection& connection);
+
+        int listen_fd_;
+        int wake_fd_ = -1;
+        /** Copied into every accepted connection. */
+        RequestProcessor processor_;
+        std::size_t max_output_bytes_;
+        io_uring ring_{};
+        bool ring_initialized_ = false;
+        io_uring_buf_ring* buffer_ring_ = nullptr;
+        std::unique_ptr<char[]> buffers_;
+        std::uint64_t wake_value_ = 0;
+        std::atomic<bool> stopping_{false};
+        std::unordered_map<int, std::unique_ptr<Connection>> connections_;
+        std::vector<Connection*> send_queue_;
+    };
+
+    /**
+     * @brief io_uring network backend: one UringWorker thread per configured io thread.
+     */
+    class UringServer {
+    public:
+        UringServer(const ServerConfig& config, std::shared_ptr<command::CommandDispatcher> dispatcher);
+        ~UringServer();
+
+        UringServer(const UringServer&) = delete;
+        UringServer& operator=(const UringServer&) = delete;
+
+        /**
+         * @brief Whether the running kernel provides everything the backend needs
+         *        (multishot recv and provided buffer rings, i.e. Linux 6.0+).
+         */
+        static bool is_supported() noexcept;
+
+        /**
+         * @brief Binds one listener per worker and starts the worker threads.
+         *
+         * @return The bound port, or an error if a listener or a ring could not be created
+         */
+        std::expected<unsigned short, std::error_code> start(asio::ip::tcp::endpoint endpoint);
+
+        void stop() noexcept;
+        void wait();
+
+    private:
+        ServerConfig config_;
+        std::shared_ptr<command::CommandDispatcher> dispatcher_;
+        std::vector<int> listen_fds_;
+        std::vector<std::unique_ptr<UringWorker>> workers_;
+        std::vector<std::thread> threads_;
+    };
+
+}
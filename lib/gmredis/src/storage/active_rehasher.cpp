@@ -0,0 +1,22 @@
+#include "gmredis/storage/active_rehasher.h"
+#include <utility>
+
+namespace gmredis::storage {
+
+    ActiveRehasher::ActiveRehasher(std::shared_ptr<KVStore> store, std::chrono::milliseconds interval,
+                                   std::chrono::microseconds budget)
+        : store_(std::move(store)), interval_(interval), budget_(budget),
+          thread_([this](const std::stop_token& stop) { run(stop); }) {}
+
+    void ActiveRehasher::run(const std::stop_token& stop) {
+        std::unique_lock lock(mutex_);
+        // Nothing notifies wakeup_: each wait ends after interval_, or early once the jthread
+        // is being destroyed
+        while (!stop.stop_requested()) {
+            if (!wakeup_.wait_for(lock, stop, interval_, [&stop] { return stop.stop_requested(); })) {
+                store_->rehash_for(budget_);
+            }
+        }
+    }
+
+}
@@ -0,0 +1,112 @@
+#include "entry.h"
+#include <cstring>
+#include <new>
+
+namespace gmredis::storage {
+
+    namespace {
+        /** The header of a value kept out of line: no size, low bit set. */
+        constexpr std::size_t external = 1;
+
+        std::size_t varint_size(std::size_t value) noexcept {
+            std::size_t size = 1;
+            for (; value >= 0x80; value >>= 7) {
+                size++;
+            }
+            return size;
+        }
+
+        std::byte* write_varint(std::byte* bytes, std::size_t value) noexcept {
+            for (; value >= 0x80; value >>= 7) {
+                *bytes++ = static_cast<std::byte>(value | 0x80);
+            }
+            *bytes++ = static_cast<std::byte>(value);
+            return bytes;
+        }
+
+        /** Offset of the shared_ptr of an external value: past the key, aligned. */
+        std::size_t shared_offset(std::size_t key_end) noexcept {
+            constexpr auto alignment = alignof(std::shared_ptr<const std::string>);
+            return (key_end + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    std::byte* Entry::make_embedded(std::string_view key, std::string_view value) {
+        auto const header = value.size() << 1;
+        auto* block = static_cast<std::byte*>(::operator new(varint_size(key.size()) + varint_size(header) + key.size() + value.size()));
+        auto* bytes = write_varint(write_varint(block, key.size()), header);
+        std::memcpy(bytes, key.data(), key.size());
+        std::memcpy(bytes + key.size(), value.data(), value.size());
+        return block;
+    }
+
+    std::byte* Entry::make_external(std::string_view key, SharedValue value) {
+        auto const key_end = varint_size(key.size()) + varint_size(external) + key.size();
+        auto const offset = shared_offset(key_end);
+        // operator new aligns for any fundamental type, so the offset alone aligns the shared_ptr
+        auto* block = static_cast<std::byte*>(::operator new(offset + sizeof(SharedValue)));
+        auto* bytes = write_varint(write_varint(block, key.size()), external);
+        std::memcpy(bytes, key.data(), key.size());
+        ::new (static_cast<void*>(block + offset)) SharedValue(std::move(value));
+        return block;
+    }
+
+    Entry& Entry::operator=(Entry&& other) noexcept {
+        if (this != &other) {
+            release();
+            block_ = std::exchange(other.block_, nullptr);
+        }
+        return *this;
+    }
+
+    Entry::~Entry() {
+        release();
+    }
+
+    Entry::Layout Entry::layout() const noexcept {
+        const auto* bytes = block_;
+        auto const key_size = read_varint(bytes);
+        auto const header = read_varint(bytes);
+        return {header, static_cast<std::size_t>(bytes - block_) + key_size};
+    }
+
+    const Entry::SharedValue* Entry::shared(const Layout& layout) const noexcept {
+        if (layout.header != external) {
+            return nullptr;
+        }
+        return std::launder(static_cast<const SharedValue*>(static_cast<const void*>(block_ + shared_offset(layout.key_end))));
+    }
+
+    std::string_view Entry::value() const noexcept {
+        auto const layout = this->layout();
+        if (const auto* value = shared(layout)) {
+            return **value;
+        }
+        return {reinterpret_cast<const char*>(block_ + layout.key_end), layout.header >> 1};
+    }
+
+    ValueView Entry::read() const noexcept {
+        return ValueView{.bytes = value(), .shared = shared(layout())};
+    }
+
+    bool Entry::overwrite(std::string_view value) noexcept {
+        auto const layout = this->layout();
+        if (layout.header == external || layout.header >> 1 != value.size()) {
+            return false;
+        }
+        std::memcpy(block_ + layout.key_end, value.data(), value.size());
+        return true;
+    }
+
+    void Entry::release() noexcept {
+        if (block_ == nullptr) {
+            return;
+        }
+        if (const auto* value = shared(layout())) {
+            std::destroy_at(value);
+        }
+        ::operator delete(block_);
+        block_ = nullptr;
+    }
+
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "gmredis/storage/kv.h"
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace gmredis::storage {
+
+    /**
+     * @brief A key and its value packed into one heap block, the way KVMemoryStore keeps them.
+     *
+     * Two std::strings cost 64 bytes before any payload, plus a heap block each once past the
+     * SSO size; with millions of small keys that overhead outweighs the data. An Entry is a
+     * single pointer to a block laid out as
+     *
+     *     varint key size | varint header | key bytes | value bytes
+     *
+     * where the header is the value size shifted left by one. Varints (7 bits per byte) keep
+     * the headers at one byte each for keys and values under 128 bytes, and two under 16 KiB.
+     *
+     * From shared_threshold bytes on, the header is just 1 and the value lives in an immutable
+     * shared buffer whose shared_ptr is stored, aligned, after the key. Such a value is never
+     * modified; overwriting it builds a new buffer, so replies still referencing the old one
+     * (ValueView::shared) keep sending what was read. Small values are cheaper to copy into a
+     * reply than to reference, so they stay in the block.
+     *
+     * @example
+     * ```cpp
+     * Entry entry("key", "value");
+     * entry.assign("other");
+     * std::string_view value = entry.value();
+     * ```
+     */
+    class Entry {
+    public:
+        static constexpr std::size_t shared_threshold = 2048;
+
+        template <typename Value>
+            requires std::convertible_to<const Value&, std::string_view>
+        Entry(std::string_view key, Value&& value) : block_(make(key, std::forward<Value>(value))) {}
+
+        Entry(Entry&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {}
+        Entry& operator=(Entry&& other) noexcept;
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+        ~Entry();
+
+        /**
+         * @brief Replaces the value. A small value the size of the current one is written in
+         *        place; otherwise the entry is rebuilt, and left as it was if that throws.
+         */
+        template <typename Value>
+            requires std::convertible_to<const Value&, std::string_view>
+        void assign(Value&& value) {
+            if (!overwrite(value)) {
+                *this = Entry(key(), std::forward<Value>(value));
+            }
+        }
+
+        [[nodiscard]] std::string_view key() const noexcept {
+            const auto* bytes = block_;
+            auto const size = read_varint(bytes);
+            read_varint(bytes);
+            return {reinterpret_cast<const char*>(bytes), size};
+        }
+
+        [[nodiscard]] std::string_view value() const noexcept;
+
+        [[nodiscard]] ValueView read() const noexcept;
+
+    private:
+        using SharedValue = std::shared_ptr<const std::string>;
+
+        template <typename Value>
+        static std::byte* make(std::string_view key, Value&& value) {
+            if (std::string_view(value).size() >= shared_threshold) {
+                return make_external(key, std::make_shared<const std::string>(std::forward<Value>(value)));
+            }
+            return make_embedded(key, value);
+        }
+
+        static std::byte* make_embedded(std::string_view key, std::string_view value);
+        static std::byte* make_external(std::string_view key, SharedValue value);
+
+        /** What the varints say: the value header and the offset just past the key. */
+        struct Layout {
+            std::size_t header;
+            std::size_t key_end;
+        };
+
+        [[nodiscard]] Layout layout() const noexcept;
+
+        /** The shared_ptr of a value kept out of line, or nullptr for an embedded one. */
+        [[nodiscard]] const SharedValue* shared(const Layout& layout) const noexcept;
+
+        /** Writes value over an embedded value of the same size. @return Whether it could */
+        bool overwrite(std::string_view value) noexcept;
+
+        void release() noexcept;
+
+        /** Decodes the varint at bytes and advances past it. */
+        static std::size_t read_varint(const std::byte*& bytes) noexcept {
+            std::size_t value = 0;
+            for (unsigned shift = 0;; shift += 7) {
+                auto const byte = std::to_integer<std::size_t>(*bytes++);
+                value |= (byte & 0x7F) << shift;
+                if (byte < 0x80) {
+                    return value;
+                }
+            }
+        }
+
+        std::byte* block_;
+    };
+
+}
@@ -0,0 +1,224 @@
+#include "flat_table.h"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GMREDIS_FLAT_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace gmredis::storage {
+
+    namespace {
+        constexpr std::int8_t empty = -128;
+        constexpr std::int8_t deleted = -2;
+
+        /** Low 7 bits, stored in the control byte of a full slot. */
+        std::int8_t h2(std::size_t hash) noexcept {
+            return static_cast<std::int8_t>(hash & 0x7F);
+        }
+
+        /** The remaining bits, which pick the first group to probe. */
+        std::size_t h1(std::size_t hash) noexcept {
+            return hash >> 7;
+        }
+
+        /** Most slots that may be used (full or deleted) before growing: 7/8. */
+        std::size_t max_load(std::size_t capacity) noexcept {
+            return capacity - capacity / 8;
+        }
+
+        /**
+         * @brief The control bytes of one group of slots, compared all at once.
+         *
+         * Every match returns a bit mask with bit i set for slot i of the group.
+         */
+        class Group {
+        public:
+            explicit Group(const std::int8_t* ctrl) noexcept : ctrl_(ctrl) {}
+
+#if defined(GMREDIS_FLAT_TABLE_SSE2)
+            [[nodiscard]] unsigned match(std::int8_t hash) const noexcept {
+                return mask(_mm_cmpeq_epi8(load(), _mm_set1_epi8(hash)));
+            }
+
+            [[nodiscard]] unsigned match_empty() const noexcept {
+                return mask(_mm_cmpeq_epi8(load(), _mm_set1_epi8(empty)));
+            }
+
+            /** Empty or deleted: the only negative control bytes, so just the sign bits. */
+            [[nodiscard]] unsigned match_free() const noexcept {
+                return mask(load());
+            }
+
+        private:
+            [[nodiscard]] __m128i load() const noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl_));
+            }
+
+            static unsigned mask(__m128i bytes) noexcept {
+                return static_cast<unsigned>(_mm_movemask_epi8(bytes));
+            }
+#else
+            [[nodiscard]] unsigned match(std::int8_t hash) const noexcept {
+                return match_if([hash](std::int8_t ctrl) { return ctrl == hash; });
+            }
+
+            [[nodiscard]] unsigned match_empty() const noexcept {
+                return match_if([](std::int8_t ctrl) { return ctrl == empty; });
+            }
+
+            [[nodiscard]] unsigned match_free() const noexcept {
+                return match_if([](std::int8_t ctrl) { return ctrl < 0; });
+            }
+
+        private:
+            template <typename Predicate>
+            [[nodiscard]] unsigned match_if(Predicate predicate) const noexcept {
+                unsigned bits = 0;
+                for (std::size_t i = 0; i < FlatTable::group_width; i++) {
+                    bits |= static_cast<unsigned>(predicate(ctrl_[i])) << i;
+                }
+                return bits;
+            }
+#endif
+
+            const std::int8_t* ctrl_;
+        };
+
+        std::size_t lowest_bit(unsigned mask) noexcept {
+            return static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    FlatTable::~FlatTable() {
+        release();
+    }
+
+    std::size_t FlatTable::find_index(std::string_view key, std::size_t hash) const noexcept {
+        if (capacity_ == 0) {
+            return capacity_;
+        }
+
+        auto const groups_mask = capacity_ / group_width - 1;
+        auto group = h1(hash) & groups_mask;
+        for (std::size_t step = 1;; step++) {
+            auto const first = group * group_width;
+            Group const control(ctrl_.get() + first);
+            for (auto candidates = control.match(h2(hash)); candidates != 0; candidates &= candidates - 1) {
+                auto const index = first + lowest_bit(candidates);
+                if (slots_[index].key() == key) {
+                    return index;
+                }
+            }
+            // Inserts fill the first free slot on the probe sequence, so the key cannot be past
+            // a group that has never been full
+            if (control.match_empty() != 0) {
+                return capacity_;
+            }
+            group = (group + step) & groups_mask;
+        }
+    }
+
+    std::size_t FlatTable::find_free(std::size_t hash) const noexcept {
+        auto const groups_mask = capacity_ / group_width - 1;
+        auto group = h1(hash) & groups_mask;
+        for (std::size_t step = 1;; step++) {
+            if (auto const free = Group(ctrl_.get() + group * group_width).match_free(); free != 0) {
+                return group * group_width + lowest_bit(free);
+            }
+            group = (group + step) & groups_mask;
+        }
+    }
+
+    const Entry* FlatTable::find(std::string_view key) const noexcept {
+        auto const index = find_index(key, hash_of(key));
+        return index != capacity_ ? &slots_[index] : nullptr;
+    }
+
+    std::size_t FlatTable::prepare_insert(std::size_t hash) {
+        if (capacity_ == 0) {
+            rehash(group_width);
+        }
+        auto index = find_free(hash);
+        if (ctrl_[index] == empty && growth_left_ == 0) {
+            // Tombstones count against the load; when they are most of it, reclaim them in
+            // place instead of growing
+            rehash(size_ * 2 < max_load(capacity_) ? capacity_ : capacity_ * 2);
+            index = find_free(hash);
+        }
+        return index;
+    }
+
+    void FlatTable::finish_insert(std::size_t index, std::size_t hash) noexcept {
+        if (ctrl_[index] == empty) {
+            growth_left_--;
+        }
+        ctrl_[index] = h2(hash);
+        size_++;
+    }
+
+    bool FlatTable::erase(std::string_view key) noexcept {
+        auto const index = find_index(key, hash_of(key));
+        if (index == capacity_) {
+            return false;
+        }
+
+        std::destroy_at(slots_ + index);
+        size_--;
+        // A group that still has an empty slot has never been full, so no probe has gone past
+        // it and the slot can be empty again; otherwise it must stay a tombstone
+        auto const first = index / group_width * group_width;
+        if (Group(ctrl_.get() + first).match_empty() != 0) {
+            ctrl_[index] = empty;
+            growth_left_++;
+        } else {
+            ctrl_[index] = deleted;
+        }
+        return true;
+    }
+
+    void FlatTable::rehash(std::size_t capacity) {
+        auto ctrl = std::make_unique_for_overwrite<std::int8_t[]>(capacity);
+        std::fill_n(ctrl.get(), capacity, empty);
+        Slot* slots = std::allocator<Slot>{}.allocate(capacity);
+
+        auto old_ctrl = std::exchange(ctrl_, std::move(ctrl));
+        auto* old_slots = std::exchange(slots_, slots);
+        auto const old_capacity = std::exchange(capacity_, capacity);
+        growth_left_ = max_load(capacity) - size_;
+
+        for (std::size_t i = 0; i < old_capacity; i++) {
+            if (old_ctrl[i] < 0) {
+                continue;
+            }
+            auto const hash = hash_of(old_slots[i].key());
+            auto const index = find_free(hash);
+            std::construct_at(slots_ + index, std::move(old_slots[i]));
+            ctrl_[index] = h2(hash);
+            std::destroy_at(old_slots + i);
+        }
+        if (old_slots != nullptr) {
+            std::allocator<Slot>{}.deallocate(old_slots, old_capacity);
+        }
+    }
+
+    void FlatTable::release() noexcept {
+        for (std::size_t i = 0; i < capacity_; i++) {
+            if (ctrl_[i] >= 0) {
+                std::destroy_at(slots_ + i);
+            }
+        }
+        if (slots_ != nullptr) {
+            std::allocator<Slot>{}.deallocate(slots_, capacity_);
+        }
+        ctrl_.reset();
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "entry.h"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace gmredis::storage {
+
+    /**
+     * @brief Open-addressing string to string map with Swiss-table style control bytes.
+     *
+     * Entries live directly in one slot array, with no node per entry; each slot is an Entry,
+     * one pointer to the key and value packed together, with large values in shared buffers
+     * that replies can reference. A parallel array holds
+     * one control byte per slot: empty, deleted, or the low 7 bits of the key's hash (H2).
+     * A lookup hashes once, uses the other bits (H1) to pick a group of 16 slots, and compares
+     * the 16 control bytes against H2 in one SSE2 instruction (a scalar loop elsewhere). Only
+     * slots whose byte matches, one in 128 on average for other keys, have their key compared,
+     * and the probe stops at the first group with an empty slot.
+     *
+     * Groups are probed triangularly, which visits every group of a power-of-two table. The
+     * table grows to keep at most 7/8 of the slots used; erased slots become tombstones until
+     * the next rehash.
+     *
+     * Not thread-safe.
+     *
+     * @example
+     * ```cpp
+     * FlatTable table;
+     * table.insert_or_assign("key", "value");
+     * if (const Entry* entry = table.find("key")) { ... entry->value() ... }
+     * table.erase("key");
+     * ```
+     */
+    class FlatTable {
+    public:
+        FlatTable() noexcept = default;
+        ~FlatTable();
+
+        FlatTable(const FlatTable&) = delete;
+        FlatTable& operator=(const FlatTable&) = delete;
+
+        /**
+         * @brief The entry stored for key, or nullptr. Valid until the table is modified.
+         */
+        [[nodiscard]] const Entry* find(std::string_view key) const noexcept;
+
+        /**
+         * @brief Stores value under key, replacing any previous value.
+         *
+         * Value is std::string_view or std::string&&; a large std::string rvalue becomes the
+         * shared buffer without being copied (see Entry).
+         */
+        template <typename Value>
+            requires std::convertible_to<const Value&, std::string_view>
+        void insert_or_assign(std::string_view key, Value&& value) {
+            auto const hash = hash_of(key);
+            if (auto const index = find_index(key, hash); index != capacity_) {
+                slots_[index].assign(std::forward<Value>(value));
+                return;
+            }
+
+            auto const index = prepare_insert(hash);
+            std::construct_at(slots_ + index, key, std::forward<Value>(value));
+            finish_insert(index, hash);
+        }
+
+        /**
+         * @return Whether key was present
+         */
+        bool erase(std::string_view key) noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+        /** Number of slots (a multiple of the group width), 0 until the first insert. */
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        static constexpr std::size_t group_width = 16;
+
+    private:
+        using Slot = Entry;
+
+        static std::size_t hash_of(std::string_view key) noexcept {
+            return std::hash<std::string_view>{}(key);
+        }
+
+        /** Index of the slot holding key, or capacity_ if absent. */
+        [[nodiscard]] std::size_t find_index(std::string_view key, std::size_t hash) const noexcept;
+        /** First empty or deleted slot on hash's probe sequence; the table must have one. */
+        [[nodiscard]] std::size_t find_free(std::size_t hash) const noexcept;
+        /** A free slot for a new key with this hash, growing the table first if needed. */
+        [[nodiscard]] std::size_t prepare_insert(std::size_t hash);
+        /** Marks the slot from prepare_insert() full once its Slot is constructed. */
+        void finish_insert(std::size_t index, std::size_t hash) noexcept;
+        void rehash(std::size_t capacity);
+        void release() noexcept;
+
+        /** One byte per slot; see the class description. */
+        std::unique_ptr<std::int8_t[]> ctrl_;
+        /** Raw storage: only slots whose control byte is full hold a constructed Slot. */
+        Slot* slots_ = nullptr;
+        std::size_t capacity_ = 0;
+        std::size_t size_ = 0;
+        /** Empty slots that may still be filled before the table must grow. */
+        std::size_t growth_left_ = 0;
+    };
+
+}
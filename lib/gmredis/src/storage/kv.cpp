@@ -0,0 +1,27 @@
+#include "gmredis/storage/kv.h"
+#include "kv_flat.h"
+#include "kv_mem.h"
+#include "kv_sharded.h"
+
+namespace gmredis::storage {
+
+    std::unique_ptr<KVStore> make_store(StoreBackend backend) {
+        if (backend == StoreBackend::Flat) {
+            return std::make_unique<ShardedKVStore>(ShardedKVStore::default_shard_count,
+                                                    [] { return std::make_unique<KVFlatStore>(); });
+        }
+        return std::make_unique<ShardedKVStore>(ShardedKVStore::default_shard_count,
+                                                [] { return std::make_unique<KVMemoryStore>(); });
+    }
+
+    std::string_view to_string(StoreBackend backend) noexcept {
+        switch (backend) {
+            case StoreBackend::Unordered:
+                return "unordered";
+            case StoreBackend::Flat:
+                return "flat";
+        }
+        return "unknown";
+    }
+
+}
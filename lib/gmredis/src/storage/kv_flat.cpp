@@ -0,0 +1,38 @@
+#include "kv_flat.h"
+#include <format>
+#include <utility>
+
+namespace gmredis::storage {
+
+    std::expected<void, ErrorInfo> KVFlatStore::put(std::string_view key, std::string_view value) {
+        store_.insert_or_assign(key, value);
+        return {};
+    }
+
+    std::expected<void, ErrorInfo> KVFlatStore::put_owned(std::string &&key, std::string &&value) {
+        store_.insert_or_assign(key, std::move(value));
+        return {};
+    }
+
+    std::expected<int, ErrorInfo> KVFlatStore::del(std::string_view key) {
+        return store_.erase(key) ? 1 : 0;
+    }
+
+    std::expected<std::string, ErrorInfo> KVFlatStore::get(std::string_view key) {
+        const auto* entry = store_.find(key);
+        if (entry == nullptr) {
+            return std::unexpected{ErrorInfo(KVError::KeyNotFound, std::format("{} was not found", key))};
+        }
+        return std::string(entry->value());
+    }
+
+    std::expected<void, ErrorInfo> KVFlatStore::read(std::string_view key, const std::function<void(const ValueView &)> &reader) {
+        const auto* entry = store_.find(key);
+        if (entry == nullptr) {
+            return std::unexpected{ErrorInfo(KVError::KeyNotFound, std::format("{} was not found", key))};
+        }
+        reader(entry->read());
+        return {};
+    }
+
+}
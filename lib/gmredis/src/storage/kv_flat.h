@@ -0,0 +1,32 @@
+#pragma once
+
+#include "flat_table.h"
+#include "gmredis/storage/kv.h"
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace gmredis::storage {
+
+    /**
+     * @brief In-memory store on a FlatTable: same behaviour as KVMemoryStore, without a node
+     *        allocation per key or pointer chasing on lookups.
+     *
+     * Values are kept the way KVMemoryStore keeps them, so read() hands out large ones by
+     * reference too; see Entry.
+     *
+     * Not thread-safe; the server puts it behind ShardedKVStore.
+     */
+    class KVFlatStore : public KVStore {
+    public:
+        std::expected<void, ErrorInfo> put(std::string_view key, std::string_view value) override;
+        std::expected<void, ErrorInfo> put_owned(std::string &&key, std::string &&value) override;
+        std::expected<std::string, ErrorInfo> get(std::string_view key) override;
+        std::expected<void, ErrorInfo> read(std::string_view key, const std::function<void(const ValueView &)> &reader) override;
+        std::expected<int, ErrorInfo> del(std::string_view key) override;
+
+    private:
+        FlatTable store_;
+    };
+
+}
@@ -1,27 +1,110 @@
 #include "kv_mem.h"
 #include <format>
+#include <utility>
 #include <spdlog/spdlog.h>
 
 namespace gmredis::storage {
 
-    std::expected<void, ErrorInfo> KVMemoryStore::put(const std::string &key, const std::string &value) {
-        store_[key] = value;
+    template <typename Value>
+    void KVMemoryStore::assign(std::string_view key, Value &&value) {
+        rehash_step(rehash_batch);
+
+        // Set elements are const only because the hash depends on them; it depends on the key
+        // alone, so assigning the value in place is safe
+        if (auto old = draining_.find(key); old != draining_.end()) {
+            const_cast<Entry &>(*old).assign(std::forward<Value>(value));
+            store_.insert(draining_.extract(old));
+            return;
+        }
+        if (auto current = store_.find(key); current != store_.end()) {
+            const_cast<Entry &>(*current).assign(std::forward<Value>(value));
+            return;
+        }
+
+        if (draining_.empty() && static_cast<float>(store_.size() + 1) > store_.max_load_factor() * static_cast<float>(store_.bucket_count())) {
+            // store_ would rehash in place on this insert; drain it incrementally instead. At
+            // least one node moves per put, so draining finishes before store_ fills up
+            draining_ = std::move(store_);
+            store_ = Table();
+            store_.reserve(draining_.size() * 2);
+        }
+        store_.emplace(key, std::forward<Value>(value));
+    }
+
+    std::expected<void, ErrorInfo> KVMemoryStore::put(std::string_view key, std::string_view value) {
         spdlog::debug("KVMemoryStore.put called with key: {}, value: {}", key, value);
+        assign(key, value);
         return {};
     }
 
-    std::expected<int, ErrorInfo> KVMemoryStore::del([[maybe_unused]]const std::string &key) {
+    std::expected<void, ErrorInfo> KVMemoryStore::put_owned(std::string &&key, std::string &&value) {
+        spdlog::debug("KVMemoryStore.put_owned called with key: {}, value: {}", key, value);
+        assign(key, std::move(value));
+        return {};
+    }
+
+    std::expected<int, ErrorInfo> KVMemoryStore::del(std::string_view key) {
+        rehash_step(rehash_batch);
+        // erase() only takes a view from C++23 on; find() already does
+        for (auto* table : {&store_, &draining_}) {
+            if (auto entry = table->find(key); entry != table->end()) {
+                table->erase(entry);
+                return 1;
+            }
+        }
         return 0;
     }
 
-    std::expected<std::string, ErrorInfo> KVMemoryStore::get(const std::string &key) {
+    const Entry* KVMemoryStore::find(std::string_view key) const {
+        if (auto result = store_.find(key); result != store_.end()) {
+            return &*result;
+        }
+        if (auto result = draining_.find(key); result != draining_.end()) {
+            return &*result;
+        }
+        return nullptr;
+    }
+
+    std::expected<std::string, ErrorInfo> KVMemoryStore::get(std::string_view key) {
         spdlog::debug("KVMemoryStore.get called with key: {}", key);
-        auto result = store_.find(key);
-        if (result == store_.end()) {
+        const auto* entry = find(key);
+        if (entry == nullptr) {
             spdlog::debug("KVMemoryStore.get called with key: {}, key not found", key);
             return std::unexpected{ErrorInfo(KVError::KeyNotFound, std::format("{} was not found", key))};
         }
-        return result->second;
+        return std::string(entry->value());
+    }
+
+    std::expected<void, ErrorInfo> KVMemoryStore::read(std::string_view key, const std::function<void(const ValueView &)> &reader) {
+        const auto* entry = find(key);
+        if (entry == nullptr) {
+            return std::unexpected{ErrorInfo(KVError::KeyNotFound, std::format("{} was not found", key))};
+        }
+        reader(entry->read());
+        return {};
+    }
+
+    bool KVMemoryStore::rehash_for(std::chrono::microseconds budget) {
+        // Checking the clock costs about as much as moving a node, so check every batch
+        constexpr std::size_t batch = 128;
+        auto const deadline = std::chrono::steady_clock::now() + budget;
+        while (rehashing() && std::chrono::steady_clock::now() < deadline) {
+            rehash_step(batch);
+        }
+        return rehashing();
+    }
+
+    void KVMemoryStore::rehash_step(std::size_t count) {
+        if (draining_.empty()) {
+            return;
+        }
+        for (; count > 0 && !draining_.empty(); count--) {
+            store_.insert(draining_.extract(draining_.begin()));
+        }
+        if (draining_.empty()) {
+            // Give back the old bucket array rather than keeping it until the next rehash
+            draining_ = Table();
+        }
     }
 
-}
\ No newline at end of file
+}
@@ -5,17 +5,104 @@
 #pragma once
 
 #include "gmredis/storage/kv.h"
-#include <unordered_map>
+#include "entry.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
 
 namespace gmredis::storage {
+
+    /**
+     * @brief In-memory store on std::unordered_set that grows without a full-table pause.
+     *
+     * Each key and value is one Entry, a single block with the key and a small value packed
+     * behind one-byte length headers; the node holding it is 24 bytes, which is glibc's
+     * smallest allocation anyway.
+     *
+     * An unordered_set past its load factor relinks every node into a new bucket array inside
+     * the insert that crossed it, which on a large table stalls that request for as long as it
+     * takes to touch every key. Instead, before the table would grow, it becomes the draining
+     * table and an empty one with twice the room takes its place. New keys go to the new
+     * table; every put and del then moves up to rehash_batch nodes across (spliced with
+     * extract, so keys and values are neither copied nor reallocated), and rehash_for()
+     * moves more when called in the background. Lookups check both tables.
+     *
+     * get() and read() do not move anything, since ShardedKVStore runs them under a shared
+     * lock. read() hands out large values by reference; see Entry.
+     *
+     * Not thread-safe.
+     */
     class KVMemoryStore : public KVStore {
     public:
-        std::expected<void, ErrorInfo> put(const std::string &key, const std::string &value) override;
-        std::expected<std::string, ErrorInfo> get(const std::string &key) override;
-        std::expected<int, ErrorInfo> del(const std::string &key) override;
+        /** Nodes a put or del moves out of the draining table. */
+        static constexpr std::size_t rehash_batch = 4;
+
+        std::expected<void, ErrorInfo> put(std::string_view key, std::string_view value) override;
+        std::expected<void, ErrorInfo> put_owned(std::string &&key, std::string &&value) override;
+        std::expected<std::string, ErrorInfo> get(std::string_view key) override;
+        std::expected<void, ErrorInfo> read(std::string_view key, const std::function<void(const ValueView &)> &reader) override;
+        std::expected<int, ErrorInfo> del(std::string_view key) override;
+        bool rehash_for(std::chrono::microseconds budget) override;
+
+        [[nodiscard]] bool rehashing() const noexcept { return !draining_.empty(); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return store_.size() + draining_.size(); }
 
     private:
-        std::unordered_map<std::string, std::string> store_;
+        /**
+         * @brief Hashes an Entry by its key, or a bare key, so the tables can be probed with a
+         *        std::string_view.
+         *
+         * Deliberately not noexcept: libstdc++ then keeps each hash in its node, which fits in
+         * the 24 bytes the node rounds up to anyway. Bucket walks and the rehash moves then
+         * compare cached hashes instead of reading every Entry's block.
+         */
+        struct KeyHash {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view key) const {
+                return std::hash<std::string_view>{}(key);
+            }
+
+            std::size_t operator()(const Entry &entry) const {
+                return (*this)(entry.key());
+            }
+        };
+
+        struct KeyEqual {
+            using is_transparent = void;
+
+            bool operator()(const Entry &lhs, const Entry &rhs) const noexcept {
+                return lhs.key() == rhs.key();
+            }
+
+            bool operator()(std::string_view lhs, const Entry &rhs) const noexcept {
+                return lhs == rhs.key();
+            }
+
+            bool operator()(const Entry &lhs, std::string_view rhs) const noexcept {
+                return lhs.key() == rhs;
+            }
+        };
+
+        using Table = std::unordered_set<Entry, KeyHash, KeyEqual>;
+
+        /** put() and put_owned(): Value is std::string_view or std::string&&. */
+        template <typename Value>
+        void assign(std::string_view key, Value &&value);
+
+        /** The entry for key in either table, or nullptr. */
+        [[nodiscard]] const Entry* find(std::string_view key) const;
+
+        /** Moves up to count nodes from draining_ to store_. */
+        void rehash_step(std::size_t count);
+
+        /** Where new keys go. Sized when a rehash starts so it never rehashes during one. */
+        Table store_;
+        /** The previous table while its keys are being moved to store_; empty otherwise. */
+        Table draining_;
     };
 
 
@@ -0,0 +1,110 @@
+#include "kv_sharded.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace gmredis::storage {
+
+    ShardedKVStore::ShardedKVStore(std::size_t shard_count, const std::function<std::unique_ptr<KVStore>()>& make_shard)
+        : shards_(std::make_unique<Shard[]>(std::bit_ceil(std::max<std::size_t>(shard_count, 1)))),
+          mask_(std::bit_ceil(std::max<std::size_t>(shard_count, 1)) - 1) {
+        for (std::size_t i = 0; i <= mask_; i++) {
+            shards_[i].store = make_shard();
+        }
+    }
+
+    std::size_t ShardedKVStore::shard_of(std::string_view key) const noexcept {
+        // The shard stores hash the same keys with the same function; multiplying and taking
+        // high bits keeps the shard index from correlating with their bucket index
+        auto const hash = static_cast<std::uint64_t>(std::hash<std::string_view>{}(key));
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+    }
+
+    std::expected<void, ErrorInfo> ShardedKVStore::put(std::string_view key, std::string_view value) {
+        auto& shard = shards_[shard_of(key)];
+        std::unique_lock const lock(shard.mutex);
+        return shard.store->put(key, value);
+    }
+
+    std::expected<void, ErrorInfo> ShardedKVStore::put_owned(std::string&& key, std::string&& value) {
+        auto& shard = shards_[shard_of(key)];
+        std::unique_lock const lock(shard.mutex);
+        return shard.store->put_owned(std::move(key), std::move(value));
+    }
+
+    std::expected<int, ErrorInfo> ShardedKVStore::del(std::string_view key) {
+        auto& shard = shards_[shard_of(key)];
+        std::unique_lock const lock(shard.mutex);
+        return shard.store->del(key);
+    }
+
+    std::expected<std::string, ErrorInfo> ShardedKVStore::get(std::string_view key) {
+        auto& shard = shards_[shard_of(key)];
+        std::shared_lock const lock(shard.mutex);
+        return shard.store->get(key);
+    }
+
+    std::expected<void, ErrorInfo> ShardedKVStore::read(std::string_view key, const std::function<void(const ValueView&)>& reader) {
+        auto& shard = shards_[shard_of(key)];
+        std::shared_lock const lock(shard.mutex);
+        return shard.store->read(key, reader);
+    }
+
+    bool ShardedKVStore::rehash_for(std::chrono::microseconds budget) {
+        auto const deadline = std::chrono::steady_clock::now() + budget;
+        bool pending = false;
+        for (std::size_t i = 0; i <= mask_; i++) {
+            std::unique_lock const lock(shards_[i].mutex, std::try_to_lock);
+            if (!lock.owns_lock()) {
+                pending = true;
+                continue;
+            }
+            // Shards past the deadline still get a zero budget, which only reports their state
+            auto const left = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+            pending = shards_[i].store->rehash_for(std::max(left, std::chrono::microseconds::zero())) || pending;
+        }
+        return pending;
+    }
+
+    ShardedKVStore::KeyLocks ShardedKVStore::lock(std::span<const std::string_view> keys, LockMode mode) const {
+        std::vector<std::size_t> shards;
+        shards.reserve(keys.size());
+        for (auto const key : keys) {
+            shards.push_back(shard_of(key));
+        }
+        // A global order on the shards is what rules out deadlocks between multi-key commands
+        std::ranges::sort(shards);
+        auto const duplicates = std::ranges::unique(shards);
+        shards.erase(duplicates.begin(), duplicates.end());
+        return KeyLocks(*this, std::move(shards), mode);
+    }
+
+    ShardedKVStore::KeyLocks::KeyLocks(const ShardedKVStore& owner, std::vector<std::size_t> shards, LockMode mode)
+        : owner_(&owner), shards_(std::move(shards)), mode_(mode) {
+        for (auto const index : shards_) {
+            if (mode_ == LockMode::Exclusive) {
+                owner_->shards_[index].mutex.lock();
+            } else {
+                owner_->shards_[index].mutex.lock_shared();
+            }
+        }
+    }
+
+    ShardedKVStore::KeyLocks::~KeyLocks() {
+        for (auto const index : shards_) {
+            if (mode_ == LockMode::Exclusive) {
+                owner_->shards_[index].mutex.unlock();
+            } else {
+                owner_->shards_[index].mutex.unlock_shared();
+            }
+        }
+    }
+
+    KVStore& ShardedKVStore::KeyLocks::store(std::string_view key) const noexcept {
+        return *owner_->shards_[owner_->shard_of(key)].store;
+    }
+
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "gmredis/storage/kv.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmredis::storage {
+
+    /**
+     * @brief Thread-safe store that spreads keys over independently locked shards.
+     *
+     * ThreadSafeKVStore puts one shared_mutex around the whole store, so every write
+     * serializes every thread and even reads bounce the lock's cache line between cores. Here
+     * each key hashes to one of a power-of-two number of shards, each on its own cache line
+     * with its own lock and its own single-threaded store; operations on keys in different
+     * shards never touch the same lock.
+     *
+     * Commands touching several keys take all their shards at once with lock(), which
+     * acquires them in shard order so two such commands cannot deadlock.
+     *
+     * @example
+     * ```cpp
+     * ShardedKVStore store(64, [] { return std::make_unique<KVMemoryStore>(); });
+     * store.put("a", "1");
+     *
+     * std::string_view const keys[] = {"a", "b"};
+     * auto locks = store.lock(keys, ShardedKVStore::LockMode::Exclusive);
+     * locks.store("a").put("a", "2");
+     * locks.store("b").put("b", "3");
+     * ```
+     */
+    class ShardedKVStore : public KVStore {
+    public:
+        static constexpr std::size_t default_shard_count = 64;
+
+        enum class LockMode {
+            Shared,
+            Exclusive
+        };
+
+        /**
+         * @brief Shard locks held for a multi-key operation; released on destruction.
+         */
+        class KeyLocks {
+        public:
+            KeyLocks(KeyLocks&& other) noexcept = default;
+            KeyLocks& operator=(KeyLocks&&) = delete;
+            KeyLocks(const KeyLocks&) = delete;
+            KeyLocks& operator=(const KeyLocks&) = delete;
+            ~KeyLocks();
+
+            /**
+             * @brief The unsynchronized store holding key, which this object has locked.
+             *
+             * @pre key was one of the keys passed to lock()
+             */
+            [[nodiscard]] KVStore& store(std::string_view key) const noexcept;
+
+        private:
+            friend class ShardedKVStore;
+            KeyLocks(const ShardedKVStore& owner, std::vector<std::size_t> shards, LockMode mode);
+
+            const ShardedKVStore* owner_;
+            /** Sorted and unique. */
+            std::vector<std::size_t> shards_;
+            LockMode mode_;
+        };
+
+        /**
+         * @param shard_count Rounded up to a power of two (at least 1)
+         * @param make_shard Creates the store behind each shard; it is only used under the
+         *                   shard's lock, so it need not be thread-safe
+         */
+        ShardedKVStore(std::size_t shard_count, const std::function<std::unique_ptr<KVStore>()>& make_shard);
+
+        std::expected<void, ErrorInfo> put(std::string_view key, std::string_view value) override;
+        std::expected<void, ErrorInfo> put_owned(std::string&& key, std::string&& value) override;
+        std::expected<std::string, ErrorInfo> get(std::string_view key) override;
+        std::expected<void, ErrorInfo> read(std::string_view key, const std::function<void(const ValueView&)>& reader) override;
+        std::expected<int, ErrorInfo> del(std::string_view key) override;
+
+        /**
+         * @brief Gives each shard's store what is left of budget, skipping shards whose lock is
+         *        held rather than waiting for requests.
+         *
+         * @return Whether any shard is still rehashing or was skipped
+         */
+        bool rehash_for(std::chrono::microseconds budget) override;
+
+        /**
+         * @brief Locks the shards of every key, in shard order.
+         *
+         * Each shard is locked once, however many of the keys it holds. Do not call the
+         * store's own put/get/del for these keys while the locks are held; go through
+         * KeyLocks::store(). The keys may view a request buffer; they are not kept.
+         */
+        [[nodiscard]] KeyLocks lock(std::span<const std::string_view> keys, LockMode mode) const;
+
+        [[nodiscard]] std::size_t shard_count() const noexcept { return mask_ + 1; }
+
+        /**
+         * @brief Index of the shard holding key.
+         */
+        [[nodiscard]] std::size_t shard_of(std::string_view key) const noexcept;
+
+    private:
+        struct alignas(64) Shard {
+            std::shared_mutex mutex;
+            std::unique_ptr<KVStore> store;
+        };
+
+        std::unique_ptr<Shard[]> shards_;
+        std::size_t mask_;
+    };
+
+}
@@ -1,19 +1,35 @@
 #include "kv_threading.h"
+#include <utility>
 
 namespace gmredis::storage {
-    std::expected<void, ErrorInfo> ThreadSafeKVStore::put(const std::string &key, const std::string &value) {
+    std::expected<void, ErrorInfo> ThreadSafeKVStore::put(std::string_view key, std::string_view value) {
         std::unique_lock const lock(mutex_);
         return store_->put(key, value);
     }
 
-    std::expected<int, ErrorInfo> ThreadSafeKVStore::del(const std::string &key) {
+    std::expected<void, ErrorInfo> ThreadSafeKVStore::put_owned(std::string &&key, std::string &&value) {
+        std::unique_lock const lock(mutex_);
+        return store_->put_owned(std::move(key), std::move(value));
+    }
+
+    std::expected<int, ErrorInfo> ThreadSafeKVStore::del(std::string_view key) {
         std::unique_lock const lock(mutex_);
         return store_->del(key);
     }
 
-    std::expected<std::string, ErrorInfo> ThreadSafeKVStore::get(const std::string &key) {
+    std::expected<std::string, ErrorInfo> ThreadSafeKVStore::get(std::string_view key) {
         std::shared_lock const lock(mutex_);
         return store_->get(key);
     }
 
+    std::expected<void, ErrorInfo> ThreadSafeKVStore::read(std::string_view key, const std::function<void(const ValueView &)> &reader) {
+        std::shared_lock const lock(mutex_);
+        return store_->read(key, reader);
+    }
+
+    bool ThreadSafeKVStore::rehash_for(std::chrono::microseconds budget) {
+        std::unique_lock const lock(mutex_);
+        return store_->rehash_for(budget);
+    }
+
 }
\ No newline at end of file
@@ -9,9 +9,12 @@ namespace gmredis::storage {
     class ThreadSafeKVStore : public KVStore {
     public:
         explicit ThreadSafeKVStore(std::unique_ptr<KVStore> store) : store_(std::move(store)) {}
-        std::expected<void, ErrorInfo> put(const std::string &key, const std::string &value) override;
-        std::expected<std::string, ErrorInfo> get(const std::string &key) override;
-        std::expected<int, ErrorInfo> del(const std::string &key) override;
+        std::expected<void, ErrorInfo> put(std::string_view key, std::string_view value) override;
+        std::expected<void, ErrorInfo> put_owned(std::string &&key, std::string &&value) override;
+        std::expected<std::string, ErrorInfo> get(std::string_view key) override;
+        std::expected<void, ErrorInfo> read(std::string_view key, const std::function<void(const ValueView &)> &reader) override;
+        std::expected<int, ErrorInfo> del(std::string_view key) override;
+        bool rehash_for(std::chrono::microseconds budget) override;
     private:
         std::unique_ptr<KVStore> store_;
         mutable std::shared_mutex mutex_;
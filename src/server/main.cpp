@@ -1,93 +1,180 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/server/server.h>
+#include <gmredis/storage/active_rehasher.h>
+#include <gmredis/storage/kv.h>
 #include <gmredis/version.h>
 
 #include <asio.hpp>
-#include <print>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <csignal>
 #include <memory>
+#include <optional>
+#include <print>
+#include <span>
+#include <string_view>
 
-using asio::ip::tcp;
-
-class Session : public std::enable_shared_from_this<Session> {
-public:
-    explicit Session(tcp::socket socket) : socket_(std::move(socket)) {}
-
-    void start() {
-        do_read();
-    }
-
-private:
-    void do_read() {
-        auto self(shared_from_this());
-        socket_.async_read_some(
-            asio::buffer(data_, max_length),
-            [this, self](std::error_code ec, std::size_t length) {
-                if (!ec) {
-                    std::println("Received {} bytes from client", length);
-                    do_write(length);
-                } else {
-                    std::println("Read error: {}", ec.message());
-                }
-            });
-    }
+namespace {
 
-    void do_write(std::size_t length) {
-        auto self(shared_from_this());
-        asio::async_write(
-            socket_,
-            asio::buffer(data_, length),
-            [this, self](std::error_code ec, std::size_t /*length*/) {
-                if (!ec) {
-                    do_read();
-                } else {
-                    std::println("Write error: {}", ec.message());
-                }
-            });
+template <typename T>
+std::optional<T> parse_number(std::string_view text) {
+    T value{};
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc() || ptr != text.data() + text.size()) {
+        return std::nullopt;
     }
+    return value;
+}
 
-    tcp::socket socket_;
-    static constexpr std::size_t max_length = 1024;
-    char data_[max_length];
-};
+void print_usage() {
+    std::println("Usage: gmredis-server [--bind ADDR] [--port PORT] [--threads N] [--pin-threads]");
+    std::println("                      [--no-reuseport] [--io-uring] [--proto-max-bulk-len BYTES]");
+    std::println("                      [--max-multibulk-len N] [--max-inline-len BYTES]");
+    std::println("                      [--client-query-buffer-limit BYTES]");
+    std::println("                      [--slowlog-log-slower-than USEC] [--slowlog-max-len N]");
+    std::println("                      [--store unordered|flat] [--no-active-rehashing]");
+}
 
-class Server {
-public:
-    Server(asio::io_context& io_context, unsigned short port)
-        : acceptor_(io_context, tcp::endpoint(tcp::v4(), port)) {
-        do_accept();
+std::optional<gmredis::server::ServerConfig> parse_args(std::span<char*> args) {
+    gmredis::server::ServerConfig config;
+
+    for (std::size_t i = 1; i < args.size(); i++) {
+        std::string_view arg = args[i];
+        auto next_value = [&]() -> std::optional<std::string_view> {
+            if (i + 1 >= args.size()) {
+                return std::nullopt;
+            }
+            return std::string_view{args[++i]};
+        };
+
+        if (arg == "--bind") {
+            auto value = next_value();
+            if (!value) {
+                return std::nullopt;
+            }
+            config.bind_address = *value;
+        } else if (arg == "--port") {
+            auto value = next_value();
+            auto port = value ? parse_number<unsigned short>(*value) : std::nullopt;
+            if (!port) {
+                return std::nullopt;
+            }
+            config.port = *port;
+        } else if (arg == "--threads") {
+            auto value = next_value();
+            auto threads = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!threads) {
+                return std::nullopt;
+            }
+            config.io_threads = *threads;
+        } else if (arg == "--pin-threads") {
+            config.pin_threads = true;
+        } else if (arg == "--no-reuseport") {
+            config.reuse_port = false;
+        } else if (arg == "--io-uring") {
+            config.backend = gmredis::server::NetworkBackend::IoUring;
+        } else if (arg == "--proto-max-bulk-len") {
+            auto value = next_value();
+            auto limit = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!limit) {
+                return std::nullopt;
+            }
+            config.limits.max_bulk_length = *limit;
+        } else if (arg == "--max-multibulk-len") {
+            auto value = next_value();
+            auto limit = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!limit) {
+                return std::nullopt;
+            }
+            config.limits.max_multibulk_length = *limit;
+        } else if (arg == "--max-inline-len") {
+            auto value = next_value();
+            auto limit = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!limit) {
+                return std::nullopt;
+            }
+            config.limits.max_inline_length = *limit;
+        } else if (arg == "--client-query-buffer-limit") {
+            auto value = next_value();
+            auto limit = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!limit) {
+                return std::nullopt;
+            }
+            config.limits.max_frame_length = *limit;
+        } else if (arg == "--slowlog-log-slower-than") {
+            auto value = next_value();
+            auto threshold = value ? parse_number<std::int64_t>(*value) : std::nullopt;
+            if (!threshold) {
+                return std::nullopt;
+            }
+            config.slowlog_log_slower_than = *threshold;
+        } else if (arg == "--slowlog-max-len") {
+            auto value = next_value();
+            auto length = value ? parse_number<std::size_t>(*value) : std::nullopt;
+            if (!length) {
+                return std::nullopt;
+            }
+            config.slowlog_max_len = *length;
+        } else if (arg == "--store") {
+            auto value = next_value();
+            if (value == "unordered") {
+                config.store_backend = gmredis::storage::StoreBackend::Unordered;
+            } else if (value == "flat") {
+                config.store_backend = gmredis::storage::StoreBackend::Flat;
+            } else {
+                return std::nullopt;
+            }
+        } else if (arg == "--no-active-rehashing") {
+            config.active_rehashing = false;
+        } else {
+            return std::nullopt;
+        }
     }
 
-private:
-    void do_accept() {
-        acceptor_.async_accept(
-            [this](std::error_code ec, tcp::socket socket) {
-                if (!ec) {
-                    std::println("New client connected from {}:{}",
-                        socket.remote_endpoint().address().to_string(),
-                        socket.remote_endpoint().port());
-                    std::make_shared<Session>(std::move(socket))->start();
-                } else {
-                    std::println("Accept error: {}", ec.message());
-                }
-
-                do_accept();
-            });
-    }
+    return config;
+}
 
-    tcp::acceptor acceptor_;
-};
+}  // namespace
 
-int main() {
+int main(int argc, char* argv[]) {
     std::println("GMRedis Server");
     std::println("{}", gmredis::get_version_info());
-    std::println("Starting server on port 6379...");
 
-    try {
-        asio::io_context io_context;
-        Server server(io_context, 6379);
+    auto config = parse_args(std::span(argv, static_cast<std::size_t>(argc)));
+    if (!config) {
+        print_usage();
+        return 1;
+    }
 
-        std::println("Server listening on 0.0.0.0:6379");
+    try {
+        auto stats = std::make_shared<gmredis::command::Stats>();
+        auto slowlog = config->slowlog_log_slower_than >= 0
+                           ? std::make_shared<gmredis::command::SlowLog>(
+                                 std::chrono::microseconds(config->slowlog_log_slower_than), config->slowlog_max_len)
+                           : nullptr;
+        std::shared_ptr<gmredis::storage::KVStore> store = gmredis::storage::make_store(config->store_backend);
+        auto rehasher = config->active_rehashing ? std::make_unique<gmredis::storage::ActiveRehasher>(store) : nullptr;
+        auto dispatcher = std::make_shared<gmredis::command::CommandDispatcher>(
+            gmredis::command::make_command_selector(store, stats, slowlog), stats);
+        gmredis::server::Server server(*config, dispatcher);
+        if (auto started = server.start(); !started) {
+            std::println(stderr, "Error: unable to listen on {}:{}: {}", config->bind_address,
+                         config->port, started.error().message());
+            return 1;
+        }
+
+        std::println("Server listening on {}:{} ({} io threads, {})", config->bind_address,
+                     server.port(), server.io_threads(), gmredis::server::to_string(server.backend()));
         std::println("Press Ctrl+C to stop");
 
-        io_context.run();
+        // Signals are handled on a dedicated context so the io threads stay untouched.
+        asio::io_context signal_context;
+        asio::signal_set signals(signal_context, SIGINT, SIGTERM);
+        signals.async_wait([&server](std::error_code, int) { server.stop(); });
+        signal_context.run();
+
+        server.wait();
     } catch (const std::exception& e) {
         std::println(stderr, "Error: {}", e.what());
         return 1;
@@ -0,0 +1,249 @@
+#include <gmredis/command/dispatcher.h>
+#include <gmredis/server/server.h>
+#include <gmredis/storage/kv.h>
+
+#include <asio.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using gmredis::server::Server;
+using gmredis::server::ServerConfig;
+
+namespace {
+
+std::shared_ptr<gmredis::command::CommandDispatcher> make_dispatcher() {
+    auto stats = std::make_shared<gmredis::command::Stats>();
+    // Every command is slow enough for the slow log
+    auto slowlog = std::make_shared<gmredis::command::SlowLog>(std::chrono::microseconds(0), 16);
+    return std::make_shared<gmredis::command::CommandDispatcher>(
+        gmredis::command::make_command_selector(gmredis::storage::make_store(), stats, slowlog), stats);
+}
+
+asio::ip::tcp::socket connect(asio::io_context& io_context, const Server& server) {
+    asio::ip::tcp::socket socket(io_context);
+    socket.connect({asio::ip::make_address("127.0.0.1"), server.port()});
+    return socket;
+}
+
+std::string read_exactly(asio::ip::tcp::socket& socket, std::size_t size) {
+    std::string reply(size, '\0');
+    asio::read(socket, asio::buffer(reply));
+    return reply;
+}
+
+std::string round_trip(asio::ip::tcp::socket& socket, const std::string& request, std::size_t reply_size) {
+    asio::write(socket, asio::buffer(request));
+    return read_exactly(socket, reply_size);
+}
+
+std::string read_bulk(asio::ip::tcp::socket& socket) {
+    asio::streambuf buffer;
+    auto header_size = asio::read_until(socket, buffer, "\r\n");
+    std::string header(asio::buffers_begin(buffer.data()), asio::buffers_begin(buffer.data()) + static_cast<std::ptrdiff_t>(header_size));
+    buffer.consume(header_size);
+
+    auto const total = std::stoul(header.substr(1)) + 2;
+    if (buffer.size() < total) {
+        asio::read(socket, buffer, asio::transfer_exactly(total - buffer.size()));
+    }
+    return {asio::buffers_begin(buffer.data()), asio::buffers_begin(buffer.data()) + static_cast<std::ptrdiff_t>(total - 2)};
+}
+
+std::string bulk_request(const std::vector<std::string>& args) {
+    std::string request = "*" + std::to_string(args.size()) + "\r\n";
+    for (const auto& arg : args) {
+        request += "$" + std::to_string(arg.size()) + "\r\n" + arg + "\r\n";
+    }
+    return request;
+}
+
+}  // namespace
+
+TEST_CASE("Server accepts connections on every io thread", "[server]") {
+    auto reuse_port = GENERATE(true, false);
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 4,
+                               .reuse_port = reuse_port},
+                  make_dispatcher());
+    REQUIRE(server.start().has_value());
+    REQUIRE(server.port() != 0);
+    REQUIRE(server.io_threads() == 4);
+
+    asio::io_context client_context;
+    std::vector<asio::ip::tcp::socket> clients;
+    for (int i = 0; i < 16; i++) {
+        clients.push_back(connect(client_context, server));
+    }
+
+    for (auto& socket : clients) {
+        REQUIRE(round_trip(socket, "*1\r\n$4\r\nPING\r\n", 7) == "+PONG\r\n");
+    }
+
+    server.stop();
+    server.wait();
+}
+
+TEST_CASE("Server executes commands from the RESP stream", "[server]") {
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 2}, make_dispatcher());
+    REQUIRE(server.start().has_value());
+
+    asio::io_context client_context;
+    auto socket = connect(client_context, server);
+
+    SECTION("SET then GET a value larger than a single read") {
+        std::string const value(64 * 1024, 'v');
+        REQUIRE(round_trip(socket, bulk_request({"SET", "big", value}), 5) == "+OK\r\n");
+
+        auto expected = "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+        REQUIRE(round_trip(socket, bulk_request({"GET", "big"}), expected.size()) == expected);
+    }
+
+    SECTION("GET on a missing key returns a null bulk string") {
+        REQUIRE(round_trip(socket, bulk_request({"GET", "missing"}), 5) == "$-1\r\n");
+    }
+
+    SECTION("A frame split across writes is reassembled") {
+        auto request = bulk_request({"SET", "split", "value"});
+        for (char c : request) {
+            asio::write(socket, asio::buffer(&c, 1));
+        }
+        REQUIRE(read_exactly(socket, 5) == "+OK\r\n");
+    }
+
+    SECTION("Pipelined requests are answered in order") {
+        auto request = bulk_request({"SET", "a", "1"}) + bulk_request({"GET", "a"}) + bulk_request({"PING"});
+        REQUIRE(round_trip(socket, request, 5 + 7 + 7) == "+OK\r\n$1\r\n1\r\n+PONG\r\n");
+    }
+
+    SECTION("COMMAND describes the command set") {
+        REQUIRE(round_trip(socket, bulk_request({"COMMAND", "COUNT"}), 4) == ":7\r\n");
+
+        std::string const expected =
+            "*1\r\n*10\r\n$3\r\nget\r\n:2\r\n*2\r\n+readonly\r\n+fast\r\n:1\r\n:1\r\n:1\r\n*0\r\n*0\r\n*0\r\n*0\r\n";
+        REQUIRE(round_trip(socket, bulk_request({"COMMAND", "INFO", "GET"}), expected.size()) == expected);
+    }
+
+    SECTION("INFO reports the commands executed so far") {
+        REQUIRE(round_trip(socket, bulk_request({"SET", "a", "1"}), 5) == "+OK\r\n");
+        REQUIRE(round_trip(socket, bulk_request({"SET", "a"}), 1) == "-");
+        asio::streambuf rest;
+        asio::read_until(socket, rest, "\r\n");
+
+        asio::write(socket, asio::buffer(bulk_request({"INFO", "commandstats"})));
+        auto commandstats = read_bulk(socket);
+        REQUIRE(commandstats.starts_with("# Commandstats\r\n"));
+        REQUIRE(commandstats.find("cmdstat_set:calls=1,") != std::string::npos);
+        REQUIRE(commandstats.find("rejected_calls=1,failed_calls=0") != std::string::npos);
+
+        asio::write(socket, asio::buffer(bulk_request({"INFO", "stats"})));
+        auto stats = read_bulk(socket);
+        REQUIRE(stats.find("total_connections_received:1\r\n") != std::string::npos);
+        REQUIRE(stats.find("total_net_input_bytes:0\r\n") == std::string::npos);
+
+        asio::write(socket, asio::buffer(bulk_request({"INFO", "latencystats"})));
+        auto latencystats = read_bulk(socket);
+        REQUIRE(latencystats.find("latency_percentiles_usec_set:p50=") != std::string::npos);
+        // The earlier requests' replies were written before this one was read
+        REQUIRE(latencystats.find("request_latency_percentiles_usec:p50=") != std::string::npos);
+
+        std::string const histogram_prefix = "*2\r\n$3\r\nset\r\n*4\r\n$5\r\ncalls\r\n:1\r\n";
+        asio::write(socket, asio::buffer(bulk_request({"LATENCY", "HISTOGRAM", "set"})));
+        REQUIRE(read_exactly(socket, histogram_prefix.size()) == histogram_prefix);
+    }
+
+    SECTION("SLOWLOG reports commands with the client address") {
+        REQUIRE(round_trip(socket, bulk_request({"SET", "a", "1"}), 5) == "+OK\r\n");
+        REQUIRE(round_trip(socket, bulk_request({"SLOWLOG", "LEN"}), 4) == ":1\r\n");
+
+        std::string const expected_start = "*1\r\n*6\r\n:1\r\n";
+        asio::write(socket, asio::buffer(bulk_request({"SLOWLOG", "GET", "1"})));
+        REQUIRE(read_exactly(socket, expected_start.size()) == expected_start);
+        asio::streambuf rest;
+        auto const client = "127.0.0.1:" + std::to_string(socket.local_endpoint().port());
+        asio::read_until(socket, rest, client);
+
+        REQUIRE(round_trip(socket, bulk_request({"SLOWLOG", "RESET"}), 5) == "+OK\r\n");
+    }
+
+    SECTION("Unknown commands return an error and keep the connection open") {
+        auto reply = round_trip(socket, bulk_request({"NOPE"}), 1);
+        REQUIRE(reply == "-");
+        asio::streambuf rest;
+        asio::read_until(socket, rest, "\r\n");
+        REQUIRE(round_trip(socket, bulk_request({"PING"}), 7) == "+PONG\r\n");
+    }
+
+    SECTION("Protocol errors close the connection") {
+        asio::write(socket, asio::buffer(std::string_view{"?garbage\r\n"}));
+        asio::streambuf reply;
+        std::error_code ec;
+        asio::read(socket, reply, ec);
+        REQUIRE(ec == asio::error::eof);
+        REQUIRE(std::string(asio::buffers_begin(reply.data()), asio::buffers_end(reply.data())).starts_with("-ERR Protocol error"));
+    }
+
+    server.stop();
+    server.wait();
+}
+
+TEST_CASE("Deep pipelines are answered in bounded batches", "[server]") {
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 1,
+                               .max_batch_commands = 16, .max_batch_bytes = 64},
+                  make_dispatcher());
+    REQUIRE(server.start().has_value());
+
+    asio::io_context client_context;
+    auto socket = connect(client_context, server);
+
+    constexpr int depth = 1000;
+    std::string request;
+    std::string expected;
+    for (int i = 0; i < depth; i++) {
+        auto value = std::to_string(i);
+        request += bulk_request({"PING", value});
+        expected += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+    }
+
+    REQUIRE(round_trip(socket, request, expected.size()) == expected);
+
+    server.stop();
+    server.wait();
+}
+
+TEST_CASE("io_uring backend serves requests or falls back to epoll", "[server]") {
+    Server server(ServerConfig{.bind_address = "127.0.0.1", .port = 0, .io_threads = 2,
+                               .backend = gmredis::server::NetworkBackend::IoUring},
+                  make_dispatcher());
+    REQUIRE(server.start().has_value());
+#if !defined(GMREDIS_HAS_IO_URING)
+    REQUIRE(server.backend() == gmredis::server::NetworkBackend::Epoll);
+#endif
+
+    asio::io_context client_context;
+    std::vector<asio::ip::tcp::socket> clients;
+    for (int i = 0; i < 8; i++) {
+        clients.push_back(connect(client_context, server));
+    }
+
+    std::string const value(100 * 1024, 'u');
+    for (std::size_t i = 0; i < clients.size(); i++) {
+        auto key = "key" + std::to_string(i);
+        REQUIRE(round_trip(clients[i], bulk_request({"SET", key, value}), 5) == "+OK\r\n");
+    }
+    for (std::size_t i = 0; i < clients.size(); i++) {
+        auto key = "key" + std::to_string(i);
+        auto expected = "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+        REQUIRE(round_trip(clients[i], bulk_request({"GET", key}) + bulk_request({"PING"}), expected.size() + 7) ==
+                expected + "+PONG\r\n");
+    }
+
+    server.stop();
+    server.wait();
+}
+
+TEST_CASE("Server reports bind failures", "[server]") {
+    Server server(ServerConfig{.bind_address = "not-an-address", .port = 0, .io_threads = 1}, make_dispatcher());
+    REQUIRE_FALSE(server.start().has_value());
+}
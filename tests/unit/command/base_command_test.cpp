@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "gmredis/command/base_command.h"
+#include "gmredis/command/stats.h"
 
 namespace gmredis::test {
 
@@ -29,16 +30,16 @@ namespace gmredis::test {
         bool postExecuteCalled() const { return post_execute_called; }
 
     protected:
-        void preExecute([[maybe_unused]] const protocol::Array& arg) override {
+        void preExecute([[maybe_unused]] const protocol::ArrayRef& arg) override {
             pre_execute_called = true;
         }
 
-        void postExecute([[maybe_unused]] const protocol::Array &arg,
+        void postExecute([[maybe_unused]] const protocol::ArrayRef&arg,
                          [[maybe_unused]] std::expected<protocol::RespValue, command::CommandError> &result) override {
             post_execute_called = true;
         }
 
-        std::expected<protocol::RespValue, command::CommandError> doExecute([[maybe_unused]] const protocol::Array &arg) override {
+        std::expected<protocol::RespValue, command::CommandError> doExecute([[maybe_unused]] const protocol::ArrayRef&arg) override {
             do_execute_called = true;
             if (fail_execute) {
                 return std::unexpected<command::CommandError>(command::CommandError(command::CommandErrorCode::ExecutionFailed, "error"));
@@ -46,15 +47,15 @@ namespace gmredis::test {
             return protocol::SimpleString("ok");
         }
 
-        void preValidate([[maybe_unused]] const protocol::Array& arg) override {
+        void preValidate([[maybe_unused]] const protocol::ArrayRef& arg) override {
             pre_validate_called = true;
         }
 
-        void postValidate([[maybe_unused]] const protocol::Array &arg) override {
+        void postValidate([[maybe_unused]] const protocol::ArrayRef&arg) override {
             post_validate_called = true;
         }
 
-        std::optional<command::CommandError> doValidate([[maybe_unused]] const protocol::Array &arg) override {
+        std::optional<command::CommandError> doValidate([[maybe_unused]] const protocol::ArrayRef&arg) override {
             do_validate_called = true;
             if (fail_validate) {
                 return command::CommandError(command::CommandErrorCode::InvalidArgument, "error");
@@ -75,7 +76,7 @@ namespace gmredis::test {
 
     TEST(BaseCommandTest, HappyPathValidation) {
         auto command = FakeCommand();
-        auto arg = protocol::Array{.values={}};
+        auto arg = protocol::ArrayView{.values={}};
 
         auto result = command.validate(arg);
         ASSERT_FALSE(result.has_value());
@@ -87,7 +88,7 @@ namespace gmredis::test {
 
     TEST(BaseCommandTest, HappyPathExecution) {
         auto command = FakeCommand();
-        auto arg = protocol::Array{.values={}};
+        auto arg = protocol::ArrayView{.values={}};
         auto result = command.execute(arg);
 
         ASSERT_TRUE(result.has_value());
@@ -98,7 +99,7 @@ namespace gmredis::test {
 
     TEST(BaseCommandTest, ValidationFailed) {
         auto command = FakeCommand(true, false);
-        auto arg = protocol::Array{.values={}};
+        auto arg = protocol::ArrayView{.values={}};
         auto result = command.validate(arg);
 
         ASSERT_TRUE(result.has_value());
@@ -109,7 +110,7 @@ namespace gmredis::test {
 
     TEST(BaseCommandTest, ExecutionFailed) {
         auto command = FakeCommand(false, true);
-        auto arg = protocol::Array{.values={}};
+        auto arg = protocol::ArrayView{.values={}};
         auto result = command.execute(arg);
 
         ASSERT_FALSE(result.has_value());
@@ -118,4 +119,121 @@ namespace gmredis::test {
         ASSERT_TRUE(command.postExecuteCalled());
     }
 
-}
\ No newline at end of file
+    /** Streams a two element array, or fails before writing anything. */
+    class StreamingCommand : public command::BaseCommand {
+    public:
+        explicit StreamingCommand(bool fail_execution = false) : fail_execute(fail_execution) {}
+
+    protected:
+        std::optional<command::CommandError> doValidate([[maybe_unused]] const protocol::ArrayRef& arg) override {
+            return std::nullopt;
+        }
+
+        std::expected<protocol::RespValue, command::CommandError> doExecute(const protocol::ArrayRef& arg) override {
+            return materialize(arg);
+        }
+
+        std::optional<command::CommandError> doExecuteInto([[maybe_unused]] const protocol::ArrayRef& arg,
+                                                           protocol::ReplySink& sink) override {
+            if (fail_execute) {
+                return command::CommandError(command::CommandErrorCode::ExecutionFailed, "error");
+            }
+            sink.begin_array(2);
+            sink.bulk("a");
+            sink.integer(7);
+            return std::nullopt;
+        }
+
+    private:
+        bool fail_execute;
+    };
+
+    TEST(BaseCommandTest, ExecuteIntoWritesTheResult) {
+        auto command = FakeCommand();
+        auto arg = protocol::ArrayView{.values={}};
+        std::string output;
+        protocol::ReplySink sink(output);
+
+        ASSERT_FALSE(command.executeInto(arg, sink).has_value());
+        EXPECT_EQ(output, "+ok\r\n");
+        ASSERT_TRUE(command.preExecuteCalled());
+        ASSERT_TRUE(command.postExecuteCalled());
+    }
+
+    TEST(BaseCommandTest, ExecuteIntoReportsFailures) {
+        auto command = FakeCommand(false, true);
+        auto arg = protocol::ArrayView{.values={}};
+        std::string output;
+        protocol::ReplySink sink(output);
+
+        auto const error = command.executeInto(arg, sink);
+        ASSERT_TRUE(error.has_value());
+        EXPECT_EQ(error->code, command::CommandErrorCode::ExecutionFailed);
+        EXPECT_TRUE(output.empty());
+    }
+
+    TEST(BaseCommandTest, StreamingCommandsCanBeMaterialized) {
+        auto command = StreamingCommand();
+        auto arg = protocol::ArrayView{.values={}};
+        std::string output;
+        protocol::ReplySink sink(output);
+
+        ASSERT_FALSE(command.executeInto(arg, sink).has_value());
+        EXPECT_EQ(output, "*2\r\n$1\r\na\r\n:7\r\n");
+
+        auto const result = command.execute(arg);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), (protocol::RespValue{protocol::Array{.values = {
+            protocol::BulkString{.value = "a", .length = 1}, protocol::Integer{7}}}}));
+
+        auto failing = StreamingCommand(true);
+        ASSERT_FALSE(failing.execute(arg).has_value());
+    }
+
+    TEST(BaseCommandTest, RecordsStatsOnceEnabled) {
+        auto stats = std::make_shared<command::Stats>();
+        auto ok = FakeCommand();
+        auto failing = FakeCommand(true, true);
+        ok.enableStats(command::CommandType::Get, stats);
+        failing.enableStats(command::CommandType::Set, stats);
+        auto arg = protocol::ArrayView{.values={}};
+
+        ASSERT_TRUE(ok.validate(arg) == std::nullopt);
+        ASSERT_TRUE(ok.execute(arg).has_value());
+        ASSERT_TRUE(failing.validate(arg).has_value());
+        ASSERT_FALSE(failing.execute(arg).has_value());
+
+        std::string output;
+        protocol::ReplySink sink(output);
+        ASSERT_FALSE(ok.executeInto(arg, sink).has_value());
+
+        auto const snapshot = stats->snapshot();
+        const auto& get = snapshot.commands[static_cast<std::size_t>(command::CommandType::Get)];
+        const auto& set = snapshot.commands[static_cast<std::size_t>(command::CommandType::Set)];
+        EXPECT_EQ(get.calls, 2);
+        EXPECT_EQ(get.rejected_calls, 0);
+        EXPECT_EQ(get.failed_calls, 0);
+        EXPECT_EQ(set.calls, 1);
+        EXPECT_EQ(set.rejected_calls, 1);
+        EXPECT_EQ(set.failed_calls, 1);
+    }
+
+    TEST(BaseCommandTest, RecordsSlowExecutions) {
+        auto slowlog = std::make_shared<command::SlowLog>(std::chrono::microseconds(0), 4);
+        auto command = FakeCommand();
+        command.enableSlowLog(slowlog);
+        auto arg = protocol::ArrayView{.values={protocol::BulkStringView{.value = "fake"}}};
+
+        ASSERT_TRUE(command.execute(arg).has_value());
+        auto const entries = slowlog->entries(1);
+        ASSERT_EQ(entries.size(), 1);
+        EXPECT_EQ(entries[0].arguments, std::vector<std::string>{"fake"});
+    }
+
+    TEST(BaseCommandTest, RecordsNothingByDefault) {
+        auto command = FakeCommand();
+        auto arg = protocol::ArrayView{.values={}};
+        ASSERT_TRUE(command.execute(arg).has_value());
+    }
+
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/command_command.h"
+#include "gmredis/command/command_spec.h"
+#include "gmredis/protocol/parse.h"
+#include "gmredis/protocol/serialize.h"
+#include "support/resp_builders.h"
+
+namespace gmredis::test {
+
+    namespace {
+        std::string encode(const protocol::RespValue& value) {
+            return protocol::serialize(value);
+        }
+    }
+
+    TEST(CommandCommandTest, CountMatchesSpecTable) {
+        auto cmd = command::CommandCommand();
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("COMMAND"), bulk("count")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(encode(result.value()), ":" + std::to_string(command::command_specs.size()) + "\r\n");
+    }
+
+    TEST(CommandCommandTest, InfoDescribesNamedCommands) {
+        auto cmd = command::CommandCommand();
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("COMMAND"), bulk("INFO"), bulk("set"), bulk("nope")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(encode(result.value()),
+                  "*2\r\n"
+                  "*10\r\n$3\r\nset\r\n:-3\r\n*1\r\n+write\r\n:1\r\n:1\r\n:1\r\n*0\r\n*0\r\n*0\r\n*0\r\n"
+                  "$-1\r\n");
+    }
+
+    TEST(CommandCommandTest, ListsEveryCommand) {
+        auto cmd = command::CommandCommand();
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("COMMAND")}});
+        ASSERT_TRUE(result.has_value());
+
+        auto const encoded = encode(result.value());
+        std::string_view input = encoded;
+        auto parsed = protocol::parse(input);
+        ASSERT_TRUE(parsed.has_value());
+        const auto& all = std::get<protocol::Array>(parsed.value());
+        ASSERT_EQ(all.values.size(), command::command_specs.size());
+        for (std::size_t i = 0; i < all.values.size(); i++) {
+            const auto& description = std::get<protocol::Array>(all.values[i]);
+            EXPECT_EQ(std::get<protocol::BulkString>(description.values[0]).value, command::command_specs[i].name);
+            EXPECT_EQ(std::get<protocol::Integer>(description.values[1]).value, command::command_specs[i].arity);
+        }
+
+        // INFO without names is the same list
+        auto info = cmd.execute(protocol::ArrayView{.values = {bulk("COMMAND"), bulk("INFO")}});
+        ASSERT_TRUE(info.has_value());
+        EXPECT_EQ(encode(info.value()), encode(result.value()));
+    }
+
+    TEST(CommandCommandTest, RejectsUnknownSubcommands) {
+        auto cmd = command::CommandCommand();
+        auto result = cmd.validate(protocol::ArrayView{.values = {bulk("COMMAND"), bulk("LIST")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::InvalidArgument);
+
+        result = cmd.validate(protocol::ArrayView{.values = {bulk("COMMAND"), bulk("COUNT"), bulk("extra")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::WrongArgumentCount);
+    }
+
+}
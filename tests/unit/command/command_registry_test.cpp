@@ -5,11 +5,11 @@
 namespace gmredis::test {
     class TestCommand : public command::Command {
     public:
-        std::optional<command::CommandError> validate(const protocol::Array&) override {
+        std::optional<command::CommandError> validate(const protocol::ArrayRef&) override {
             return std::nullopt;  // Always valid
         }
 
-        std::expected<protocol::RespValue, command::CommandError> execute(const protocol::Array&) override {
+        std::expected<protocol::RespValue, command::CommandError> execute(const protocol::ArrayRef&) override {
             return protocol::SimpleString("OK");  // Simple stub response
         }
     };
@@ -23,7 +23,7 @@ namespace gmredis::test {
 
         auto returnedCmd = registry.getCommand(command::CommandType::Ping);
         ASSERT_TRUE(returnedCmd.has_value());
-        ASSERT_EQ(returnedCmd.value(), cmd);
+        ASSERT_EQ(&returnedCmd.value().get(), cmd.get());
     }
 
     TEST(CommandRegistryTest, NullCommandRegistration) {
@@ -68,8 +68,19 @@ namespace gmredis::test {
         auto returnedCmd1 = registry.getCommand(command::CommandType::Ping);
         auto returnedCmd2 = registry.getCommand(command::CommandType::Get);
 
-        ASSERT_EQ(returnedCmd1.value(), cmd1);
-        ASSERT_EQ(returnedCmd2.value(), cmd2);
+        ASSERT_EQ(&returnedCmd1.value().get(), cmd1.get());
+        ASSERT_EQ(&returnedCmd2.value().get(), cmd2.get());
     }
 
-}
\ No newline at end of file
+    TEST(CommandRegistryTest, GetCommandSharesNoOwnership) {
+        auto registry = command::DefaultCommandRegistry();
+        auto cmd = std::make_shared<TestCommand>();
+        ASSERT_FALSE(registry.registerCommand(command::CommandType::Set, cmd).has_value());
+        auto const owners = cmd.use_count();
+
+        auto returnedCmd = registry.getCommand(command::CommandType::Set);
+        ASSERT_TRUE(returnedCmd.has_value());
+        EXPECT_EQ(cmd.use_count(), owners);
+    }
+
+}
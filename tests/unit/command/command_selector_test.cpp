@@ -10,15 +10,15 @@ namespace gmredis::test {
 
     class MockCommand : public command::Command {
     public:
-        MOCK_METHOD(std::optional<command::CommandError>, validate, (const protocol::Array&), (override));
-        MOCK_METHOD((std::expected<protocol::RespValue, command::CommandError>), execute, (const protocol::Array&), (override));
+        MOCK_METHOD(std::optional<command::CommandError>, validate, (const protocol::ArrayRef&), (override));
+        MOCK_METHOD((std::expected<protocol::RespValue, command::CommandError>), execute, (const protocol::ArrayRef&), (override));
     };
 
     class MockCommandRegistry : public command::CommandRegistry {
     public:
         MOCK_METHOD(std::optional<command::CommandRegistryError>, registerCommand,
                    (command::CommandType, std::shared_ptr<command::Command>), (noexcept, override));
-        MOCK_METHOD((std::expected<std::shared_ptr<command::Command>, command::CommandRegistryError>),
+        MOCK_METHOD((std::expected<std::reference_wrapper<command::Command>, command::CommandRegistryError>),
                    getCommand, (command::CommandType), (const, noexcept, override));
     };
 
@@ -27,16 +27,16 @@ namespace gmredis::test {
         auto mockCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Ping))
-            .WillOnce(Return(mockCmd));
+            .WillOnce(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
         protocol::Array req;
         req.values.push_back(protocol::BulkString{.value = "PING", .length = 4});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_TRUE(result.has_value());
-        ASSERT_EQ(result.value(), mockCmd);
+        ASSERT_EQ(&result.value().get(), mockCmd.get());
     }
 
     TEST(CommandSelectorTest, SelectValidPingCommandLowercase) {
@@ -44,16 +44,16 @@ namespace gmredis::test {
         auto mockCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Ping))
-            .WillOnce(Return(mockCmd));
+            .WillOnce(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
         protocol::Array req;
         req.values.push_back(protocol::BulkString{.value = "ping", .length = 4});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_TRUE(result.has_value());
-        ASSERT_EQ(result.value(), mockCmd);
+        ASSERT_EQ(&result.value().get(), mockCmd.get());
     }
 
     TEST(CommandSelectorTest, SelectValidGetCommand) {
@@ -61,7 +61,7 @@ namespace gmredis::test {
         auto mockCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Get))
-            .WillOnce(Return(mockCmd));
+            .WillOnce(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
@@ -69,9 +69,9 @@ namespace gmredis::test {
         req.values.push_back(protocol::BulkString{.value = "GET", .length = 3});
         req.values.push_back(protocol::BulkString{.value = "key1", .length = 4});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_TRUE(result.has_value());
-        ASSERT_EQ(result.value(), mockCmd);
+        ASSERT_EQ(&result.value().get(), mockCmd.get());
     }
 
     TEST(CommandSelectorTest, EmptyArrayError) {
@@ -80,7 +80,7 @@ namespace gmredis::test {
 
         protocol::Array req;  // Empty array
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_FALSE(result.has_value());
         ASSERT_EQ(result.error().code, command::CommandErrorCode::WrongArgumentCount);
     }
@@ -92,7 +92,7 @@ namespace gmredis::test {
         protocol::Array req;
         req.values.push_back(protocol::SimpleString("PING"));  // Should be BulkString
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_FALSE(result.has_value());
         ASSERT_EQ(result.error().code, command::CommandErrorCode::InvalidArgument);
     }
@@ -105,7 +105,7 @@ namespace gmredis::test {
         req.values.push_back(protocol::BulkString{.value = "SET", .length = 3});
         req.values.push_back(protocol::Integer(123));  // Should be BulkString
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_FALSE(result.has_value());
         ASSERT_EQ(result.error().code, command::CommandErrorCode::InvalidArgument);
     }
@@ -117,7 +117,7 @@ namespace gmredis::test {
         protocol::Array req;
         req.values.push_back(protocol::BulkString{.value = "UNKNOWN", .length = 7});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_FALSE(result.has_value());
         ASSERT_EQ(result.error().code, command::CommandErrorCode::CommandNotFound);
     }
@@ -133,7 +133,7 @@ namespace gmredis::test {
         protocol::Array req;
         req.values.push_back(protocol::BulkString{.value = "PING", .length = 4});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_FALSE(result.has_value());
         ASSERT_EQ(result.error().code, command::CommandErrorCode::CommandNotFound);
     }
@@ -145,7 +145,7 @@ namespace gmredis::test {
         // Expect multiple calls for different case variations
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Ping))
             .Times(5)
-            .WillRepeatedly(Return(mockCmd));
+            .WillRepeatedly(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
@@ -155,9 +155,9 @@ namespace gmredis::test {
         for (const auto& variation : variations) {
             protocol::Array req;
             req.values.push_back(protocol::BulkString{.value = variation, .length = 4});
-            auto result = selector.select(req);
+            auto result = selector.select(protocol::to_view(req));
             ASSERT_TRUE(result.has_value()) << "Failed for variation: " << variation;
-            ASSERT_EQ(result.value(), mockCmd);
+            ASSERT_EQ(&result.value().get(), mockCmd.get());
         }
     }
 
@@ -166,7 +166,7 @@ namespace gmredis::test {
         auto mockCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Set))
-            .WillOnce(Return(mockCmd));
+            .WillOnce(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
@@ -177,9 +177,9 @@ namespace gmredis::test {
         req.values.push_back(protocol::BulkString{.value = "EX", .length = 2});
         req.values.push_back(protocol::BulkString{.value = "3600", .length = 4});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_TRUE(result.has_value());
-        ASSERT_EQ(result.value(), mockCmd);
+        ASSERT_EQ(&result.value().get(), mockCmd.get());
     }
 
     TEST(CommandSelectorTest, SelectDifferentCommands) {
@@ -189,37 +189,37 @@ namespace gmredis::test {
         auto setCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Ping))
-            .WillOnce(Return(pingCmd));
+            .WillOnce(Return(std::ref<command::Command>(*pingCmd)));
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Get))
-            .WillOnce(Return(getCmd));
+            .WillOnce(Return(std::ref<command::Command>(*getCmd)));
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Set))
-            .WillOnce(Return(setCmd));
+            .WillOnce(Return(std::ref<command::Command>(*setCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
         // Test PING
         protocol::Array pingReq;
         pingReq.values.push_back(protocol::BulkString{.value = "PING", .length = 4});
-        auto pingResult = selector.select(pingReq);
+        auto pingResult = selector.select(protocol::to_view(pingReq));
         ASSERT_TRUE(pingResult.has_value());
-        ASSERT_EQ(pingResult.value(), pingCmd);
+        ASSERT_EQ(&pingResult.value().get(), pingCmd.get());
 
         // Test GET
         protocol::Array getReq;
         getReq.values.push_back(protocol::BulkString{.value = "GET", .length = 3});
         getReq.values.push_back(protocol::BulkString{.value = "key", .length = 3});
-        auto getResult = selector.select(getReq);
+        auto getResult = selector.select(protocol::to_view(getReq));
         ASSERT_TRUE(getResult.has_value());
-        ASSERT_EQ(getResult.value(), getCmd);
+        ASSERT_EQ(&getResult.value().get(), getCmd.get());
 
         // Test SET
         protocol::Array setReq;
         setReq.values.push_back(protocol::BulkString{.value = "SET", .length = 3});
         setReq.values.push_back(protocol::BulkString{.value = "key", .length = 3});
         setReq.values.push_back(protocol::BulkString{.value = "value", .length = 5});
-        auto setResult = selector.select(setReq);
+        auto setResult = selector.select(protocol::to_view(setReq));
         ASSERT_TRUE(setResult.has_value());
-        ASSERT_EQ(setResult.value(), setCmd);
+        ASSERT_EQ(&setResult.value().get(), setCmd.get());
     }
 
     TEST(CommandSelectorTest, AllArgumentsMustBeBulkStrings) {
@@ -231,7 +231,7 @@ namespace gmredis::test {
         req1.values.push_back(protocol::BulkString{.value = "SET", .length = 3});
         req1.values.push_back(protocol::BulkString{.value = "key", .length = 3});
         req1.values.push_back(protocol::Integer(42));
-        auto result1 = selector.select(req1);
+        auto result1 = selector.select(protocol::to_view(req1));
         ASSERT_FALSE(result1.has_value());
         ASSERT_EQ(result1.error().code, command::CommandErrorCode::InvalidArgument);
 
@@ -239,7 +239,7 @@ namespace gmredis::test {
         protocol::Array req2;
         req2.values.push_back(protocol::BulkString{.value = "GET", .length = 3});
         req2.values.push_back(protocol::SimpleString("key"));
-        auto result2 = selector.select(req2);
+        auto result2 = selector.select(protocol::to_view(req2));
         ASSERT_FALSE(result2.has_value());
         ASSERT_EQ(result2.error().code, command::CommandErrorCode::InvalidArgument);
 
@@ -248,7 +248,7 @@ namespace gmredis::test {
         req3.values.push_back(protocol::BulkString{.value = "SET", .length = 3});
         protocol::Array nestedArray;
         req3.values.push_back(nestedArray);
-        auto result3 = selector.select(req3);
+        auto result3 = selector.select(protocol::to_view(req3));
         ASSERT_FALSE(result3.has_value());
         ASSERT_EQ(result3.error().code, command::CommandErrorCode::InvalidArgument);
     }
@@ -258,7 +258,7 @@ namespace gmredis::test {
         auto mockCmd = std::make_shared<MockCommand>();
 
         EXPECT_CALL(*mockRegistry, getCommand(command::CommandType::Set))
-            .WillOnce(Return(mockCmd));
+            .WillOnce(Return(std::ref<command::Command>(*mockCmd)));
 
         auto selector = command::DefaultCommandSelector(std::move(mockRegistry));
 
@@ -267,8 +267,8 @@ namespace gmredis::test {
         req.values.push_back(protocol::BulkString{.value = "key", .length = 3});
         req.values.push_back(protocol::BulkString{.value = "value", .length = 5});
 
-        auto result = selector.select(req);
+        auto result = selector.select(protocol::to_view(req));
         ASSERT_TRUE(result.has_value());
-        ASSERT_EQ(result.value(), mockCmd);
+        ASSERT_EQ(&result.value().get(), mockCmd.get());
     }
 }
\ No newline at end of file
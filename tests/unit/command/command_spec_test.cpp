@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/command_spec.h"
+#include "support/resp_builders.h"
+#include <cstddef>
+
+namespace gmredis::test {
+
+    TEST(CommandSpecTest, EveryCommandTypeHasItsSpec) {
+        for (std::size_t i = 0; i < command::command_type_count; i++) {
+            auto const type = static_cast<command::CommandType>(i);
+            const auto& spec = command::command_spec(type);
+            EXPECT_EQ(spec.type, type);
+            EXPECT_EQ(command::get_command(spec.name), type) << spec.name;
+        }
+    }
+
+    TEST(CommandSpecTest, ExactArity) {
+        const auto& get = command::command_spec(command::CommandType::Get);
+
+        auto result = command::check_arguments(get, protocol::ArrayView{.values = {bulk("GET")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::WrongArgumentCount);
+        EXPECT_EQ(result->message, "wrong number of arguments for 'get' command");
+
+        EXPECT_TRUE(command::check_arguments(get, protocol::ArrayView{.values = {bulk("GET"), bulk("a"), bulk("b")}}).has_value());
+        EXPECT_FALSE(command::check_arguments(get, protocol::ArrayView{.values = {bulk("GET"), bulk("key")}}).has_value());
+    }
+
+    TEST(CommandSpecTest, MinimumArity) {
+        const auto& set = command::command_spec(command::CommandType::Set);
+
+        auto result = command::check_arguments(set, protocol::ArrayView{.values = {bulk("SET"), bulk("key")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::WrongArgumentCount);
+
+        EXPECT_FALSE(command::check_arguments(set, protocol::ArrayView{.values = {bulk("SET"), bulk("key"), bulk("value")}}).has_value());
+        EXPECT_FALSE(command::check_arguments(set, protocol::ArrayView{.values = {bulk("SET"), bulk("k"), bulk("v"), bulk("NX")}}).has_value());
+    }
+
+    TEST(CommandSpecTest, ArgumentsMustBeBulkStrings) {
+        const auto& ping = command::command_spec(command::CommandType::Ping);
+
+        auto result = command::check_arguments(ping, protocol::ArrayView{.values = {
+            bulk("PING"),
+            protocol::SimpleStringView{.value = "notbulk"}
+        }});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::InvalidArgument);
+        EXPECT_EQ(result->message, "All arguments must be BulkStrings");
+
+        result = command::check_arguments(command::command_spec(command::CommandType::Set),
+                                          protocol::ArrayView{.values = {bulk("SET"), bulk("key"), protocol::Integer{1}}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::InvalidArgument);
+    }
+
+    TEST(CommandSpecTest, KeyRange) {
+        EXPECT_TRUE(command::key_range(command::command_spec(command::CommandType::Ping), 2).empty());
+        EXPECT_EQ(command::key_range(command::command_spec(command::CommandType::Get), 2), (command::KeyRange{1, 1, 1}));
+        EXPECT_EQ(command::key_range(command::command_spec(command::CommandType::Set), 5), (command::KeyRange{1, 1, 1}));
+
+        // MSET-like: every other argument from the first to the last
+        command::CommandSpec const mset{"mset", command::CommandType::Set, -3, command::CommandFlag::Write, 1, -1, 2};
+        EXPECT_EQ(command::key_range(mset, 7), (command::KeyRange{1, 6, 2}));
+    }
+
+    TEST(CommandSpecTest, Flags) {
+        const auto& get = command::command_spec(command::CommandType::Get);
+        EXPECT_TRUE(command::has_flag(get.flags, command::CommandFlag::ReadOnly));
+        EXPECT_TRUE(command::has_flag(get.flags, command::CommandFlag::Fast));
+        EXPECT_FALSE(command::has_flag(get.flags, command::CommandFlag::Write));
+        EXPECT_TRUE(command::has_flag(command::command_spec(command::CommandType::Set).flags, command::CommandFlag::Write));
+    }
+
+}
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 #include "gmredis/command/command.h"
+#include "gmredis/command/command_spec.h"
+#include "command/command_lookup.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace gmredis::test {
@@ -209,4 +215,58 @@ namespace gmredis::test {
         EXPECT_FALSE(command::get_command("PONG").has_value()) << "'PONG' should not match 'PING'";
     }
 
-} // namespace gmredis::test
\ No newline at end of file
+    TEST(GetCommandTest, EveryTableNameResolves) {
+        for (const auto& spec : command::command_specs) {
+            auto result = command::get_command(spec.name);
+            ASSERT_TRUE(result.has_value()) << spec.name;
+            EXPECT_EQ(result.value(), spec.type) << spec.name;
+        }
+    }
+
+    TEST(GetCommandTest, OnlyLettersAreFolded) {
+        // Bytes that differ from a letter only in bit 0x20 must not match it
+        EXPECT_FALSE(command::get_command("PIN\x07").has_value());
+        EXPECT_FALSE(command::get_command("\x10ING").has_value());
+        EXPECT_FALSE(command::get_command("pin\xc7").has_value());
+        EXPECT_FALSE(command::get_command(std::string_view("GET\0", 4)).has_value());
+        EXPECT_FALSE(command::get_command("gettinglongerthansixteen").has_value());
+    }
+
+    TEST(CommandLookupTest, FoldCaseLowersOnlyAsciiLetters) {
+        auto fold = [](std::string_view text) {
+            auto key = command::detail::make_key(text);
+            std::string folded(16, '\0');
+            std::memcpy(folded.data(), &key.low, 8);
+            std::memcpy(folded.data() + 8, &key.high, 8);
+            folded.resize(text.size());
+            return folded;
+        };
+
+        EXPECT_EQ(fold("HeLLo, WORLD@[`{"), "hello, world@[`{");
+        EXPECT_EQ(fold("AZaz09_|-"), "azaz09_|-");
+        EXPECT_EQ(fold("\xc1\xda\x80\xff"), "\xc1\xda\x80\xff");
+    }
+
+    TEST(CommandLookupTest, ResolvesLargerTables) {
+        static constexpr std::array<command::CommandName, 6> names{{
+            {"get", command::CommandType::Get},
+            {"getset", command::CommandType::Set},
+            {"getdel", command::CommandType::Ping},
+            {"zremrangebyscore", command::CommandType::Get},
+            {"zremrangebyrank", command::CommandType::Set},
+            {"g", command::CommandType::Ping},
+        }};
+        constexpr command::detail::CommandLookup<names.size()> lookup{names};
+
+        for (const auto& [name, type] : names) {
+            std::string upper(name);
+            std::ranges::transform(upper, upper.begin(), [](char c) { return static_cast<char>(c - 'a' + 'A'); });
+            EXPECT_EQ(lookup.find(name), type) << name;
+            EXPECT_EQ(lookup.find(upper), type) << upper;
+        }
+        EXPECT_FALSE(lookup.find("zremrangebyscor").has_value());
+        EXPECT_FALSE(lookup.find("getse").has_value());
+        EXPECT_FALSE(lookup.find("").has_value());
+    }
+
+} // namespace gmredis::test
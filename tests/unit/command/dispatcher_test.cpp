@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/protocol/shared_replies.h"
+#include "storage/kv_mem.h"
+
+using ::testing::Return;
+using ::testing::_;
+
+namespace gmredis::test {
+
+    class MockSelector : public command::CommandSelector {
+    public:
+        MOCK_METHOD((std::expected<std::reference_wrapper<command::Command>, command::CommandError>), select,
+                    (const protocol::ArrayRef&), (override));
+    };
+
+    class StubCommand : public command::Command {
+    public:
+        MOCK_METHOD(std::optional<command::CommandError>, validate, (const protocol::ArrayRef&), (override));
+        MOCK_METHOD((std::expected<protocol::RespValue, command::CommandError>), execute, (const protocol::ArrayRef&), (override));
+    };
+
+    /** Writes part of a reply, then fails. */
+    class HalfWritingCommand : public command::Command {
+    public:
+        std::optional<command::CommandError> validate([[maybe_unused]] const protocol::ArrayRef& arg) override {
+            return std::nullopt;
+        }
+
+        std::expected<protocol::RespValue, command::CommandError> execute([[maybe_unused]] const protocol::ArrayRef& arg) override {
+            return std::unexpected(command::CommandError(command::CommandErrorCode::ExecutionFailed, "half"));
+        }
+
+        std::optional<command::CommandError> executeInto([[maybe_unused]] const protocol::ArrayRef& arg,
+                                                         protocol::ReplySink& sink) override {
+            sink.begin_array(2);
+            sink.bulk("first");
+            return command::CommandError(command::CommandErrorCode::ExecutionFailed, "half");
+        }
+    };
+
+    namespace {
+        protocol::Array request(std::initializer_list<std::string> args) {
+            protocol::Array array;
+            for (const auto& arg : args) {
+                array.values.push_back(protocol::BulkString{.value = arg, .length = arg.size()});
+            }
+            return array;
+        }
+    }
+
+    TEST(CommandDispatcherTest, ReturnsCommandResult) {
+        auto selector = std::make_shared<MockSelector>();
+        auto cmd = std::make_shared<StubCommand>();
+        EXPECT_CALL(*selector, select(_)).WillOnce(Return(std::ref<command::Command>(*cmd)));
+        EXPECT_CALL(*cmd, validate(_)).WillOnce(Return(std::nullopt));
+        EXPECT_CALL(*cmd, execute(_)).WillOnce(Return(protocol::SimpleString{"PONG"}));
+
+        command::CommandDispatcher dispatcher(selector);
+        EXPECT_EQ(dispatcher.dispatch(request({"PING"})), protocol::RespValue{protocol::SimpleString{"PONG"}});
+    }
+
+    TEST(CommandDispatcherTest, SelectionFailureBecomesErrorReply) {
+        auto selector = std::make_shared<MockSelector>();
+        EXPECT_CALL(*selector, select(_))
+            .WillOnce(Return(std::unexpected(command::CommandError(command::CommandErrorCode::CommandNotFound, "unknown"))));
+
+        command::CommandDispatcher dispatcher(selector);
+        EXPECT_EQ(dispatcher.dispatch(request({"NOPE"})), protocol::RespValue{protocol::SimpleError{"ERR unknown"}});
+    }
+
+    TEST(CommandDispatcherTest, ValidationFailureSkipsExecution) {
+        auto selector = std::make_shared<MockSelector>();
+        auto cmd = std::make_shared<StubCommand>();
+        EXPECT_CALL(*selector, select(_)).WillOnce(Return(std::ref<command::Command>(*cmd)));
+        EXPECT_CALL(*cmd, validate(_))
+            .WillOnce(Return(command::CommandError(command::CommandErrorCode::WrongArgumentCount, "bad args")));
+        EXPECT_CALL(*cmd, execute(_)).Times(0);
+
+        command::CommandDispatcher dispatcher(selector);
+        EXPECT_EQ(dispatcher.dispatch(request({"PING", "a", "b"})), protocol::RespValue{protocol::SimpleError{"ERR bad args"}});
+    }
+
+    TEST(CommandDispatcherTest, ExecutionFailureBecomesErrorReply) {
+        auto selector = std::make_shared<MockSelector>();
+        auto cmd = std::make_shared<StubCommand>();
+        EXPECT_CALL(*selector, select(_)).WillOnce(Return(std::ref<command::Command>(*cmd)));
+        EXPECT_CALL(*cmd, validate(_)).WillOnce(Return(std::nullopt));
+        EXPECT_CALL(*cmd, execute(_))
+            .WillOnce(Return(std::unexpected(command::CommandError(command::CommandErrorCode::ExecutionFailed, "boom"))));
+
+        command::CommandDispatcher dispatcher(selector);
+        EXPECT_EQ(dispatcher.dispatch(request({"PING"})), protocol::RespValue{protocol::SimpleError{"ERR boom"}});
+    }
+
+    TEST(CommandDispatcherTest, BuiltinSelectorServesPingGetSet) {
+        command::CommandDispatcher dispatcher(command::make_command_selector(std::make_shared<storage::KVMemoryStore>()));
+
+        EXPECT_EQ(dispatcher.dispatch(request({"PING"})), protocol::RespValue{protocol::shared::pong});
+        EXPECT_EQ(dispatcher.dispatch(request({"GET", "k"})), protocol::RespValue{protocol::Null{}});
+        EXPECT_EQ(dispatcher.dispatch(request({"SET", "k", "v"})), protocol::RespValue{protocol::shared::ok});
+        EXPECT_EQ(dispatcher.dispatch(request({"get", "k"})), (protocol::RespValue{protocol::BulkString{.value = "v", .length = 1}}));
+    }
+
+    TEST(CommandDispatcherTest, DispatchesIntoSink) {
+        auto selector = std::make_shared<MockSelector>();
+        auto cmd = std::make_shared<StubCommand>();
+        EXPECT_CALL(*selector, select(_)).WillOnce(Return(std::ref<command::Command>(*cmd)));
+        EXPECT_CALL(*cmd, validate(_)).WillOnce(Return(std::nullopt));
+        EXPECT_CALL(*cmd, execute(_)).WillOnce(Return(protocol::SimpleString{"PONG"}));
+
+        command::CommandDispatcher dispatcher(selector);
+        std::string output;
+        protocol::ReplySink sink(output);
+        auto const ping = request({"PING"});
+        dispatcher.dispatch(protocol::to_view(ping), sink);
+        EXPECT_EQ(output, "+PONG\r\n");
+    }
+
+    TEST(CommandDispatcherTest, FailedStreamIsReplacedByTheError) {
+        auto selector = std::make_shared<MockSelector>();
+        HalfWritingCommand cmd;
+        EXPECT_CALL(*selector, select(_)).WillOnce(Return(std::ref<command::Command>(cmd)));
+
+        command::CommandDispatcher dispatcher(selector);
+        std::string output = "+OK\r\n";
+        protocol::ReplySink sink(output);
+        auto const half = request({"HALF"});
+        dispatcher.dispatch(protocol::to_view(half), sink);
+        EXPECT_EQ(output, "+OK\r\n-ERR half\r\n");
+    }
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/get.h"
+#include "gmredis/command/set.h"
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/protocol/reply_sink.h"
+#include "gmredis/protocol/shared_replies.h"
+#include "gmredis/storage/kv.h"
+#include "storage/kv_mem.h"
+#include "support/resp_builders.h"
+#include <memory>
+#include <string>
+
+namespace gmredis::test {
+
+    TEST(SetCommandTest, ValidateRejectsOptions) {
+        auto cmd = command::SetCommand(std::make_shared<storage::KVMemoryStore>());
+
+        auto result = cmd.validate(protocol::ArrayView{.values = {bulk("SET"), bulk("key"), bulk("value"), bulk("EX"), bulk("10")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->code, command::CommandErrorCode::InvalidArgument);
+        EXPECT_EQ(result->message, "syntax error");
+
+        EXPECT_FALSE(cmd.validate(protocol::ArrayView{.values = {bulk("SET"), bulk("key"), bulk("value")}}).has_value());
+    }
+
+    TEST(SetCommandTest, ExecuteStoresValue) {
+        auto store = std::make_shared<storage::KVMemoryStore>();
+        auto cmd = command::SetCommand(store);
+
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("SET"), bulk("key"), bulk("value")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), protocol::RespValue{protocol::shared::ok});
+        EXPECT_EQ(store->get("key").value(), "value");
+    }
+
+    TEST(GetCommandTest, ExecuteReturnsStoredValue) {
+        auto store = std::make_shared<storage::KVMemoryStore>();
+        ASSERT_TRUE(store->put("key", "value").has_value());
+        auto cmd = command::GetCommand(store);
+
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("GET"), bulk("key")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), (protocol::RespValue{protocol::BulkString{.value = "value", .length = 5}}));
+    }
+
+    TEST(GetCommandTest, ExecuteMissingKeyReturnsNull) {
+        auto cmd = command::GetCommand(std::make_shared<storage::KVMemoryStore>());
+
+        auto result = cmd.execute(protocol::ArrayView{.values = {bulk("GET"), bulk("missing")}});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_TRUE(std::holds_alternative<protocol::Null>(result.value()));
+    }
+
+    TEST(GetCommandTest, ExecuteIntoReferencesLargeValues) {
+        std::string const large(storage::Entry::shared_threshold, 'x');
+        for (auto backend : {storage::StoreBackend::Unordered, storage::StoreBackend::Flat}) {
+            std::shared_ptr<storage::KVStore> store = storage::make_store(backend);
+            ASSERT_TRUE(store->put("small", "value").has_value());
+            ASSERT_TRUE(store->put("large", large).has_value());
+            auto cmd = command::GetCommand(store);
+
+            protocol::ReplyBuffer output;
+            protocol::ReplySink sink(output);
+            EXPECT_FALSE(cmd.executeInto(protocol::ArrayView{.values = {bulk("GET"), bulk("small")}}, sink).has_value());
+            EXPECT_FALSE(output.has_references()) << storage::to_string(backend);
+            EXPECT_FALSE(cmd.executeInto(protocol::ArrayView{.values = {bulk("GET"), bulk("large")}}, sink).has_value());
+            EXPECT_TRUE(output.has_references()) << storage::to_string(backend);
+            EXPECT_FALSE(cmd.executeInto(protocol::ArrayView{.values = {bulk("GET"), bulk("missing")}}, sink).has_value());
+
+            EXPECT_EQ(output.str(), "$5\r\nvalue\r\n$2048\r\n" + large + "\r\n$-1\r\n") << storage::to_string(backend);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/info.h"
+#include "support/resp_builders.h"
+
+namespace gmredis::test {
+
+    namespace {
+        std::string info(command::InfoCommand& cmd, std::vector<protocol::RespValueView> args) {
+            auto result = cmd.execute(protocol::ArrayView{.values = std::move(args)});
+            EXPECT_TRUE(result.has_value());
+            return std::get<protocol::BulkString>(result.value()).value;
+        }
+    }
+
+    TEST(InfoCommandTest, ReportsStatsSection) {
+        auto stats = std::make_shared<command::Stats>();
+        stats->record_connection();
+        stats->record_input(42);
+        stats->record_output(7);
+        stats->record_call(command::CommandType::Get, 1000, false);
+        auto cmd = command::InfoCommand(stats);
+
+        auto const reply = info(cmd, {bulk("INFO"), bulk("STATS")});
+        EXPECT_EQ(reply,
+                  "# Stats\r\n"
+                  "total_connections_received:1\r\n"
+                  "total_commands_processed:1\r\n"
+                  "instantaneous_ops_per_sec:0\r\n"
+                  "total_net_input_bytes:42\r\n"
+                  "total_net_output_bytes:7\r\n");
+    }
+
+    TEST(InfoCommandTest, ReportsCalledCommandsOnly) {
+        auto stats = std::make_shared<command::Stats>();
+        stats->record_call(command::CommandType::Set, 3000, false);
+        stats->record_call(command::CommandType::Set, 1000, true);
+        stats->record_rejected(command::CommandType::Set);
+        stats->record_rejected(command::CommandType::Get);
+        auto cmd = command::InfoCommand(stats);
+
+        auto const reply = info(cmd, {bulk("INFO"), bulk("commandstats")});
+        EXPECT_EQ(reply,
+                  "# Commandstats\r\n"
+                  "cmdstat_get:calls=0,usec=0,usec_per_call=0.00,rejected_calls=1,failed_calls=0\r\n"
+                  "cmdstat_set:calls=2,usec=4,usec_per_call=2.00,rejected_calls=1,failed_calls=1\r\n");
+    }
+
+    TEST(InfoCommandTest, ReportsLatencyPercentiles) {
+        auto stats = std::make_shared<command::Stats>();
+        stats->record_call(command::CommandType::Get, 1000, false);
+        stats->record_requests(16, 2);
+        auto cmd = command::InfoCommand(stats);
+
+        auto const reply = info(cmd, {bulk("INFO"), bulk("latencystats")});
+        EXPECT_EQ(reply,
+                  "# Latencystats\r\n"
+                  "latency_percentiles_usec_get:p50=1.023,p99=1.023,p99.9=1.023\r\n"
+                  "request_latency_percentiles_usec:p50=0.016,p99=0.016,p99.9=0.016\r\n");
+    }
+
+    TEST(InfoCommandTest, DefaultsToEverySection) {
+        auto cmd = command::InfoCommand(std::make_shared<command::Stats>());
+        auto const reply = info(cmd, {bulk("INFO")});
+        EXPECT_TRUE(reply.starts_with("# Stats\r\n"));
+        EXPECT_NE(reply.find("\r\n\r\n# Commandstats\r\n"), std::string::npos);
+        EXPECT_NE(reply.find("\r\n\r\n# Latencystats\r\n"), std::string::npos);
+        EXPECT_EQ(info(cmd, {bulk("INFO"), bulk("everything")}), reply);
+    }
+
+    TEST(InfoCommandTest, IgnoresUnknownSections) {
+        auto cmd = command::InfoCommand(nullptr);
+        EXPECT_EQ(info(cmd, {bulk("INFO"), bulk("keyspace")}), "");
+        EXPECT_TRUE(info(cmd, {bulk("INFO"), bulk("keyspace"), bulk("stats")}).starts_with("# Stats\r\n"));
+    }
+
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/latency_histogram.h"
+
+namespace gmredis::test {
+
+    namespace buckets = command::latency_buckets;
+
+    TEST(LatencyHistogramTest, BucketsCoverEveryValue) {
+        // Consecutive buckets tile the value range without gaps or overlaps
+        EXPECT_EQ(buckets::lowest_of(0), 0);
+        for (std::size_t i = 1; i < buckets::count; i++) {
+            EXPECT_EQ(buckets::lowest_of(i), buckets::highest_of(i - 1) + 1) << i;
+        }
+        EXPECT_EQ(buckets::highest_of(buckets::count - 1), buckets::max_trackable_ns);
+    }
+
+    TEST(LatencyHistogramTest, ValuesLandInTheirBucket) {
+        for (std::uint64_t value : {0ULL, 1ULL, 31ULL, 32ULL, 33ULL, 1000ULL, 123456ULL, 999999999ULL}) {
+            auto const index = buckets::index_of(value);
+            EXPECT_LE(buckets::lowest_of(index), value);
+            EXPECT_GE(buckets::highest_of(index), value);
+            // Relative error bounded by the sub-bucket resolution
+            EXPECT_LE(buckets::highest_of(index) - buckets::lowest_of(index), value / buckets::sub_bucket_count);
+        }
+        EXPECT_EQ(buckets::index_of(~std::uint64_t{0}), buckets::count - 1);
+    }
+
+    TEST(LatencyHistogramTest, ReportsPercentiles) {
+        command::LatencyHistogram histogram;
+        for (std::uint64_t i = 1; i <= 1000; i++) {
+            histogram.record(i * 1000);
+        }
+        histogram.record(5'000'000, 2);
+
+        command::HistogramSnapshot snapshot;
+        histogram.add_to(snapshot);
+        EXPECT_EQ(snapshot.total(), 1002);
+
+        auto const p50 = snapshot.value_at_percentile(50.0);
+        EXPECT_GE(p50, 501'000);
+        EXPECT_LE(p50, 501'000 + 501'000 / buckets::sub_bucket_count);
+        EXPECT_GE(snapshot.value_at_percentile(99.9), 5'000'000);
+        EXPECT_EQ(snapshot.value_at_percentile(0.0), buckets::highest_of(buckets::index_of(1000)));
+    }
+
+    TEST(LatencyHistogramTest, EmptyHistogramReportsZero) {
+        command::HistogramSnapshot snapshot;
+        EXPECT_EQ(snapshot.total(), 0);
+        EXPECT_EQ(snapshot.value_at_percentile(99.0), 0);
+    }
+
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/latency.h"
+#include "gmredis/protocol/serialize.h"
+#include "support/resp_builders.h"
+
+namespace gmredis::test {
+
+    namespace {
+        std::string latency(command::LatencyCommand& cmd, std::vector<protocol::RespValueView> args) {
+            auto arg = protocol::ArrayView{.values = std::move(args)};
+            EXPECT_FALSE(cmd.validate(arg).has_value());
+            auto result = cmd.execute(arg);
+            EXPECT_TRUE(result.has_value());
+            return protocol::serialize(result.value());
+        }
+    }
+
+    TEST(LatencyCommandTest, ReportsCumulativePowerOfTwoBuckets) {
+        auto stats = std::make_shared<command::Stats>();
+        stats->record_call(command::CommandType::Get, 800, false);
+        stats->record_call(command::CommandType::Get, 1500, false);
+        stats->record_call(command::CommandType::Get, 1900, false);
+        stats->record_call(command::CommandType::Get, 6000, false);
+        stats->record_call(command::CommandType::Set, 100, false);
+        auto cmd = command::LatencyCommand(stats);
+
+        EXPECT_EQ(latency(cmd, {bulk("LATENCY"), bulk("HISTOGRAM"), bulk("get"), bulk("nope")}),
+                  "*2\r\n"
+                  "$3\r\nget\r\n"
+                  "*4\r\n$5\r\ncalls\r\n:4\r\n$14\r\nhistogram_usec\r\n"
+                  "*6\r\n:1\r\n:1\r\n:2\r\n:3\r\n:8\r\n:4\r\n");
+    }
+
+    TEST(LatencyCommandTest, ListsCalledCommandsByDefault) {
+        auto stats = std::make_shared<command::Stats>();
+        stats->record_call(command::CommandType::Set, 100, false);
+        auto cmd = command::LatencyCommand(stats);
+
+        EXPECT_EQ(latency(cmd, {bulk("latency"), bulk("histogram")}),
+                  "*2\r\n"
+                  "$3\r\nset\r\n"
+                  "*4\r\n$5\r\ncalls\r\n:1\r\n$14\r\nhistogram_usec\r\n*2\r\n:1\r\n:1\r\n");
+    }
+
+    TEST(LatencyCommandTest, EmptyWithoutStats) {
+        auto cmd = command::LatencyCommand(nullptr);
+        EXPECT_EQ(latency(cmd, {bulk("LATENCY"), bulk("HISTOGRAM")}), "*0\r\n");
+    }
+
+    TEST(LatencyCommandTest, RejectsUnknownSubcommands) {
+        auto cmd = command::LatencyCommand(nullptr);
+        auto error = cmd.validate(protocol::ArrayView{.values = {bulk("LATENCY"), bulk("DOCTOR")}});
+        ASSERT_TRUE(error.has_value());
+        EXPECT_EQ(error->code, command::CommandErrorCode::InvalidArgument);
+    }
+
+}
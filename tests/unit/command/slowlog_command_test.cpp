@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/slowlog_command.h"
+#include "gmredis/protocol/serialize.h"
+#include "support/resp_builders.h"
+
+namespace gmredis::test {
+
+    namespace {
+        using namespace std::chrono_literals;
+
+        std::string slowlog(command::SlowLogCommand& cmd, std::vector<protocol::RespValueView> args) {
+            auto arg = protocol::ArrayView{.values = std::move(args)};
+            EXPECT_FALSE(cmd.validate(arg).has_value());
+            auto result = cmd.execute(arg);
+            EXPECT_TRUE(result.has_value());
+            return protocol::serialize(result.value());
+        }
+    }
+
+    TEST(SlowLogCommandTest, GetLenAndReset) {
+        auto log = std::make_shared<command::SlowLog>(0us, 8);
+        {
+            command::ClientScope client("10.0.0.1:6000");
+            log->record(protocol::ArrayView{.values = {bulk("get"), bulk("k")}}, 12ms);
+        }
+        log->record(protocol::ArrayView{.values = {bulk("ping")}}, 11ms);
+        auto cmd = command::SlowLogCommand(log);
+
+        EXPECT_EQ(slowlog(cmd, {bulk("SLOWLOG"), bulk("LEN")}), ":2\r\n");
+
+        auto const reply = slowlog(cmd, {bulk("SLOWLOG"), bulk("get"), bulk("1")});
+        EXPECT_TRUE(reply.starts_with("*1\r\n*6\r\n:1\r\n:"));
+        EXPECT_TRUE(reply.ends_with(":11000\r\n*1\r\n$4\r\nping\r\n$0\r\n\r\n$0\r\n\r\n"));
+
+        auto const all = slowlog(cmd, {bulk("SLOWLOG"), bulk("GET"), bulk("-1")});
+        EXPECT_TRUE(all.starts_with("*2\r\n"));
+        EXPECT_TRUE(all.ends_with("*2\r\n$3\r\nget\r\n$1\r\nk\r\n$13\r\n10.0.0.1:6000\r\n$0\r\n\r\n"));
+
+        EXPECT_EQ(slowlog(cmd, {bulk("SLOWLOG"), bulk("RESET")}), "+OK\r\n");
+        EXPECT_EQ(slowlog(cmd, {bulk("SLOWLOG"), bulk("GET")}), "*0\r\n");
+    }
+
+    TEST(SlowLogCommandTest, EmptyWithoutSlowLog) {
+        auto cmd = command::SlowLogCommand(nullptr);
+        EXPECT_EQ(slowlog(cmd, {bulk("SLOWLOG"), bulk("GET")}), "*0\r\n");
+        EXPECT_EQ(slowlog(cmd, {bulk("SLOWLOG"), bulk("LEN")}), ":0\r\n");
+    }
+
+    TEST(SlowLogCommandTest, RejectsBadArguments) {
+        auto cmd = command::SlowLogCommand(nullptr);
+        auto error = cmd.validate(protocol::ArrayView{.values = {bulk("SLOWLOG"), bulk("GET"), bulk("-2")}});
+        ASSERT_TRUE(error.has_value());
+        EXPECT_EQ(error->code, command::CommandErrorCode::InvalidArgument);
+
+        error = cmd.validate(protocol::ArrayView{.values = {bulk("SLOWLOG"), bulk("LEN"), bulk("1")}});
+        ASSERT_TRUE(error.has_value());
+        EXPECT_EQ(error->code, command::CommandErrorCode::WrongArgumentCount);
+
+        error = cmd.validate(protocol::ArrayView{.values = {bulk("SLOWLOG"), bulk("DOCTOR")}});
+        ASSERT_TRUE(error.has_value());
+        EXPECT_EQ(error->code, command::CommandErrorCode::InvalidArgument);
+    }
+
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/slowlog.h"
+#include "support/resp_builders.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        using namespace std::chrono_literals;
+
+        void record(command::SlowLog& slowlog, std::string_view name, std::chrono::nanoseconds elapsed = 20ms) {
+            slowlog.record(protocol::ArrayView{.values = {bulk(name), bulk("key")}}, elapsed);
+        }
+    }
+
+    TEST(SlowLogTest, AppliesThreshold) {
+        command::SlowLog slowlog(10ms, 4);
+        EXPECT_FALSE(slowlog.is_slow(9999us));
+        EXPECT_TRUE(slowlog.is_slow(10ms));
+    }
+
+    TEST(SlowLogTest, ReturnsNewestFirst) {
+        command::SlowLog slowlog(0us, 4);
+        {
+            command::ClientScope client("127.0.0.1:5000");
+            record(slowlog, "get", 1500us);
+        }
+        record(slowlog, "set");
+
+        auto const entries = slowlog.entries(10);
+        ASSERT_EQ(entries.size(), 2);
+        EXPECT_EQ(entries[0].id, 1);
+        EXPECT_EQ(entries[0].arguments, (std::vector<std::string>{"set", "key"}));
+        EXPECT_EQ(entries[0].client_address, "");
+        EXPECT_EQ(entries[1].id, 0);
+        EXPECT_EQ(entries[1].duration_us, 1500);
+        EXPECT_EQ(entries[1].client_address, "127.0.0.1:5000");
+        EXPECT_GT(entries[1].timestamp, 0);
+
+        EXPECT_EQ(slowlog.entries(1).size(), 1);
+        EXPECT_EQ(slowlog.size(), 2);
+    }
+
+    TEST(SlowLogTest, KeepsOnlyCapacityEntries) {
+        command::SlowLog slowlog(0us, 3);
+        for (int i = 0; i < 5; i++) {
+            record(slowlog, "get");
+        }
+        auto const entries = slowlog.entries(10);
+        ASSERT_EQ(entries.size(), 3);
+        EXPECT_EQ(entries[0].id, 4);
+        EXPECT_EQ(entries[2].id, 2);
+        EXPECT_EQ(slowlog.size(), 3);
+    }
+
+    TEST(SlowLogTest, ResetForgetsEntries) {
+        command::SlowLog slowlog(0us, 3);
+        record(slowlog, "get");
+        slowlog.reset();
+        EXPECT_EQ(slowlog.size(), 0);
+        EXPECT_TRUE(slowlog.entries(10).empty());
+
+        record(slowlog, "set");
+        ASSERT_EQ(slowlog.entries(10).size(), 1);
+        EXPECT_EQ(slowlog.entries(10)[0].id, 1);
+    }
+
+    TEST(SlowLogTest, TruncatesLongArguments) {
+        command::SlowLog slowlog(0us, 1);
+        std::string const value(command::SlowLog::max_argument_length + 5, 'v');
+        std::vector<protocol::RespValueView> args{bulk("set"), bulk("key"), bulk(value)};
+        for (std::size_t i = args.size(); i < command::SlowLog::max_arguments + 3; i++) {
+            args.push_back(bulk("x"));
+        }
+        slowlog.record(protocol::ArrayView{.values = args}, 1ms);
+
+        auto const entries = slowlog.entries(1);
+        ASSERT_EQ(entries.size(), 1);
+        const auto& arguments = entries[0].arguments;
+        ASSERT_EQ(arguments.size(), command::SlowLog::max_arguments);
+        EXPECT_EQ(arguments[2], std::string(command::SlowLog::max_argument_length, 'v') + "... (5 more bytes)");
+        EXPECT_EQ(arguments.back(), "... (4 more arguments)");
+    }
+
+    TEST(SlowLogTest, RecordsFromManyThreads) {
+        command::SlowLog slowlog(0us, 64);
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; t++) {
+            writers.emplace_back([&slowlog] {
+                for (int i = 0; i < 1000; i++) {
+                    record(slowlog, "get");
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+
+        auto const entries = slowlog.entries(64);
+        EXPECT_LE(entries.size(), 64);
+        for (std::size_t i = 1; i < entries.size(); i++) {
+            EXPECT_GT(entries[i - 1].id, entries[i].id);
+        }
+        for (const auto& entry : entries) {
+            EXPECT_EQ(entry.arguments, (std::vector<std::string>{"get", "key"}));
+        }
+    }
+
+    TEST(SlowLogTest, SizeSkipsDroppedEntries) {
+        command::SlowLog slowlog(0us, 64);
+        for (std::size_t i = 0; i < slowlog.capacity(); i++) {
+            record(slowlog, "get");
+        }
+
+        // Writers race until one finds its slot busy and drops its entry, then all stop so the
+        // dropped id stays among the newest capacity ids. Long arguments widen the race window.
+        std::string const value(command::SlowLog::max_argument_length, 'v');
+        std::vector<protocol::RespValueView> args(command::SlowLog::max_arguments, bulk(value));
+        std::atomic<bool> dropped{false};
+        auto const deadline = std::chrono::steady_clock::now() + 10s;
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; t++) {
+            writers.emplace_back([&] {
+                while (!dropped.load() && std::chrono::steady_clock::now() < deadline) {
+                    if (!slowlog.record(protocol::ArrayView{.values = args}, 20ms)) {
+                        dropped.store(true);
+                    }
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        ASSERT_TRUE(dropped.load()) << "no write was dropped";
+
+        auto const entries = slowlog.entries(slowlog.capacity());
+        EXPECT_LT(entries.size(), slowlog.capacity());
+        EXPECT_EQ(slowlog.size(), entries.size());
+    }
+
+}
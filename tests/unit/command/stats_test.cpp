@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "gmredis/command/stats.h"
+#include <thread>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        const command::CommandCounters& counters_of(const command::StatsSnapshot& snapshot, command::CommandType type) {
+            return snapshot.commands[static_cast<std::size_t>(type)];
+        }
+    }
+
+    TEST(StatsTest, StartsAtZero) {
+        command::Stats stats;
+        auto const snapshot = stats.snapshot();
+        EXPECT_EQ(snapshot.total_commands_processed(), 0);
+        EXPECT_EQ(snapshot.connections_received, 0);
+        EXPECT_EQ(counters_of(snapshot, command::CommandType::Get), command::CommandCounters{});
+    }
+
+    TEST(StatsTest, RecordsPerCommand) {
+        command::Stats stats;
+        stats.record_call(command::CommandType::Get, 1500, false);
+        stats.record_call(command::CommandType::Get, 500, true);
+        stats.record_rejected(command::CommandType::Get);
+        stats.record_call(command::CommandType::Set, 100, false);
+
+        auto const snapshot = stats.snapshot();
+        EXPECT_EQ(counters_of(snapshot, command::CommandType::Get),
+                  (command::CommandCounters{.calls = 2, .nanoseconds = 2000, .rejected_calls = 1, .failed_calls = 1}));
+        EXPECT_EQ(counters_of(snapshot, command::CommandType::Set).calls, 1);
+        EXPECT_EQ(snapshot.total_commands_processed(), 3);
+    }
+
+    TEST(StatsTest, RecordsTraffic) {
+        command::Stats stats;
+        stats.record_connection();
+        stats.record_input(10);
+        stats.record_input(5);
+        stats.record_output(7);
+
+        auto const snapshot = stats.snapshot();
+        EXPECT_EQ(snapshot.connections_received, 1);
+        EXPECT_EQ(snapshot.net_input_bytes, 15);
+        EXPECT_EQ(snapshot.net_output_bytes, 7);
+    }
+
+    TEST(StatsTest, SumsEveryThread) {
+        command::Stats stats;
+        constexpr int threads = 4;
+        constexpr int calls = 10000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&stats] {
+                for (int i = 0; i < calls; i++) {
+                    stats.record_call(command::CommandType::Ping, 1, false);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // Counts of finished threads are kept
+        EXPECT_EQ(counters_of(stats.snapshot(), command::CommandType::Ping).calls, threads * calls);
+    }
+
+    TEST(StatsTest, RecordsLatencyHistograms) {
+        command::Stats stats;
+        stats.record_call(command::CommandType::Get, 1500, false);
+        stats.record_call(command::CommandType::Get, 500, true);
+        stats.record_requests(20000, 3);
+
+        auto const snapshot = stats.latency_snapshot();
+        const auto& get = snapshot.commands[static_cast<std::size_t>(command::CommandType::Get)];
+        EXPECT_EQ(get.total(), 2);
+        EXPECT_GE(get.value_at_percentile(100.0), 1500);
+        EXPECT_EQ(snapshot.commands[static_cast<std::size_t>(command::CommandType::Set)].total(), 0);
+        EXPECT_EQ(snapshot.requests.total(), 3);
+    }
+
+    TEST(StatsTest, InstancesAreIndependent) {
+        command::Stats first;
+        {
+            command::Stats second;
+            first.record_connection();
+            second.record_connection();
+            second.record_connection();
+            first.record_connection();
+            EXPECT_EQ(second.snapshot().connections_received, 2);
+        }
+        command::Stats third;
+        third.record_connection();
+        EXPECT_EQ(first.snapshot().connections_received, 2);
+        EXPECT_EQ(third.snapshot().connections_received, 1);
+    }
+
+    TEST(StatsTest, SamplesOpsPerSecond) {
+        command::Stats stats;
+        for (int i = 0; i < 100; i++) {
+            stats.record_call(command::CommandType::Ping, 1, false);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(110));
+
+        auto const rate = stats.sample_ops_per_sec();
+        EXPECT_GT(rate, 0.0);
+        EXPECT_LE(rate, 100.0 / 0.11);
+        // Too soon for a new sample
+        EXPECT_EQ(stats.sample_ops_per_sec(), rate);
+    }
+
+}
@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/incremental_parser.h"
+#include "gmredis/protocol/parse.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        const std::vector<std::string> frames = {
+            "+OK\r\n",
+            "-ERR unknown command\r\n",
+            ":0\r\n",
+            ":-42\r\n",
+            ":+7\r\n",
+            "$-1\r\n",
+            "$0\r\n\r\n",
+            "$5\r\nhello\r\n",
+            "$4\r\na\r\nb\r\n",
+            "*0\r\n",
+            "*1\r\n$4\r\nPING\r\n",
+            "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n",
+            "*2\r\n*2\r\n:1\r\n:2\r\n*1\r\n$1\r\nx\r\n",
+            "*3\r\n*0\r\n$-1\r\n*1\r\n*1\r\n+deep\r\n",
+            "*4\r\n+s\r\n-e\r\n:9\r\n$3\r\nbul\r\n",
+        };
+
+        // Feeds frame to the parser in chunks of the given size, as a socket would deliver it.
+        std::expected<protocol::RespValueView, protocol::ParseError> parse_in_chunks(
+            protocol::IncrementalParser& parser, std::string_view frame, std::size_t chunk) {
+            for (std::size_t received = std::min(chunk, frame.size());; received = std::min(received + chunk, frame.size())) {
+                auto result = parser.parse(frame.substr(0, received));
+                if (result.has_value() || result.error() != protocol::ParseError::Incomplete || received == frame.size()) {
+                    return result;
+                }
+            }
+        }
+
+        protocol::RespValue reference(std::string_view frame) {
+            auto result = protocol::parse(frame);
+            EXPECT_TRUE(result.has_value());
+            return *result;
+        }
+    }
+
+    TEST(IncrementalParserTest, MatchesParseOnWholeFrames) {
+        protocol::IncrementalParser parser;
+        for (const auto& frame : frames) {
+            auto result = parser.parse(frame);
+            ASSERT_TRUE(result.has_value()) << frame;
+            EXPECT_EQ(protocol::to_owned(*result), reference(frame)) << frame;
+            EXPECT_EQ(parser.frame_size(), frame.size()) << frame;
+            EXPECT_FALSE(parser.in_progress());
+        }
+    }
+
+    TEST(IncrementalParserTest, MatchesParseWhenFedByteByByte) {
+        protocol::IncrementalParser parser;
+        for (const auto& frame : frames) {
+            auto result = parse_in_chunks(parser, frame, 1);
+            ASSERT_TRUE(result.has_value()) << frame;
+            EXPECT_EQ(protocol::to_owned(*result), reference(frame)) << frame;
+            EXPECT_EQ(parser.frame_size(), frame.size()) << frame;
+        }
+    }
+
+    TEST(IncrementalParserTest, MatchesParseForEverySplitPoint) {
+        for (const auto& frame : frames) {
+            for (std::size_t split = 1; split < frame.size(); split++) {
+                protocol::IncrementalParser parser;
+                auto partial = parser.parse(std::string_view(frame).substr(0, split));
+                ASSERT_FALSE(partial.has_value()) << frame << " split at " << split;
+                EXPECT_EQ(partial.error(), protocol::ParseError::Incomplete);
+
+                auto result = parser.parse(frame);
+                ASSERT_TRUE(result.has_value()) << frame << " split at " << split;
+                EXPECT_EQ(protocol::to_owned(*result), reference(frame));
+            }
+        }
+    }
+
+    TEST(IncrementalParserTest, MatchesParseOnRandomChunking) {
+        std::mt19937 rng(7);
+        std::string payload(100 * 1024, 'p');
+        std::string frame = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$" + std::to_string(payload.size()) + "\r\n" + payload + "\r\n";
+
+        for (int run = 0; run < 20; run++) {
+            protocol::IncrementalParser parser;
+            std::uniform_int_distribution<std::size_t> chunk(1, 3000);
+            auto result = parse_in_chunks(parser, frame, chunk(rng));
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(protocol::to_owned(*result), reference(frame));
+        }
+    }
+
+    TEST(IncrementalParserTest, ToleratesBufferRelocationBetweenCalls) {
+        std::string const frame = "*2\r\n$3\r\nGET\r\n$5\r\nhello\r\n";
+        protocol::IncrementalParser parser;
+
+        std::string first(frame.substr(0, 15));
+        ASSERT_FALSE(parser.parse(first).has_value());
+
+        // The bytes move (e.g. a ReadBuffer compacts) but are otherwise unchanged
+        std::string moved = frame;
+        auto result = parser.parse(moved);
+        ASSERT_TRUE(result.has_value());
+        auto& array = std::get<protocol::ArrayView>(*result);
+        EXPECT_EQ(std::get<protocol::BulkStringView>(array.values[1]).value.data(), moved.data() + 17);
+    }
+
+    TEST(IncrementalParserTest, StopsAtFrameBoundaryOfPipelinedInput) {
+        std::string const input = "*1\r\n$4\r\nPING\r\n*2\r\n$3\r\nGET\r\n$1\r\nk\r\n";
+        protocol::IncrementalParser parser;
+        std::string_view remaining = input;
+
+        auto first = parser.parse(remaining);
+        ASSERT_TRUE(first.has_value());
+        EXPECT_EQ(parser.frame_size(), 14);
+        remaining.remove_prefix(parser.frame_size());
+
+        auto second = parser.parse(remaining);
+        ASSERT_TRUE(second.has_value());
+        EXPECT_EQ(parser.frame_size(), remaining.size());
+    }
+
+    TEST(IncrementalParserTest, KeepsProgressAcrossIncompleteCalls) {
+        protocol::IncrementalParser parser;
+        EXPECT_FALSE(parser.in_progress());
+        EXPECT_FALSE(parser.parse("*2\r\n$3\r\nGET\r").has_value());
+        EXPECT_TRUE(parser.in_progress());
+        parser.reset();
+        EXPECT_FALSE(parser.in_progress());
+    }
+
+    TEST(IncrementalParserTest, RejectsMalformedInput) {
+        const std::vector<std::pair<std::string, protocol::ParseError>> cases = {
+            {"?oops\r\n", protocol::ParseError::Unsupported},
+            {"*1\r\n!x\r\n", protocol::ParseError::Unsupported},
+            {"*x\r\n", protocol::ParseError::Invalid},
+            {"*-1\r\n", protocol::ParseError::Invalid},
+            {":12a\r\n", protocol::ParseError::Invalid},
+            {"$abc\r\n", protocol::ParseError::Invalid},
+            {"$3\r\nabcd\r\n", protocol::ParseError::Invalid},
+        };
+
+        for (const auto& [input, error] : cases) {
+            protocol::IncrementalParser parser;
+            auto result = parser.parse(input);
+            ASSERT_FALSE(result.has_value()) << input;
+            EXPECT_EQ(result.error(), error) << input;
+            EXPECT_FALSE(parser.in_progress());
+        }
+    }
+
+    TEST(IncrementalParserTest, EnforcesProtocolLimits) {
+        protocol::ProtocolLimits const limits{.max_bulk_length = 16, .max_multibulk_length = 4, .max_inline_length = 8};
+        const std::vector<std::pair<std::string, bool>> cases = {
+            {"$16\r\n0123456789abcdef\r\n", true},
+            {"$17\r\n", false},
+            {"*4\r\n:1\r\n:2\r\n:3\r\n:4\r\n", true},
+            {"*5\r\n", false},
+            {"+12345678\r\n", true},
+            {"+123456789\r\n", false},
+            // Rejected before the line is complete
+            {"+123456789\r", false},
+            {"*2147483647\r\n", false},
+            {"$4294967296\r\n", false},
+        };
+
+        for (const auto& [input, accepted] : cases) {
+            protocol::IncrementalParser parser(limits);
+            auto result = parser.parse(input);
+            if (accepted) {
+                EXPECT_TRUE(result.has_value()) << input;
+            } else {
+                ASSERT_FALSE(result.has_value()) << input;
+                EXPECT_EQ(result.error(), protocol::ParseError::LimitExceeded) << input;
+                EXPECT_FALSE(parser.in_progress());
+            }
+        }
+    }
+
+    TEST(IncrementalParserTest, EnforcesNestingDepth) {
+        protocol::IncrementalParser parser({.max_nesting_depth = 2});
+        EXPECT_TRUE(parser.parse("*2\r\n*1\r\n:1\r\n*0\r\n").has_value());
+
+        auto result = parser.parse("*1\r\n*1\r\n*0\r\n");
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), protocol::ParseError::LimitExceeded);
+
+        // Rejected as soon as the array that is too deep opens, not when the frame ends
+        std::string deep;
+        for (int i = 0; i < 1000; i++) {
+            deep += "*1\r\n";
+        }
+        result = parser.parse(deep);
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), protocol::ParseError::LimitExceeded);
+        EXPECT_FALSE(parser.in_progress());
+    }
+
+    TEST(IncrementalParserTest, EnforcesFrameLength) {
+        protocol::ProtocolLimits const limits{.max_frame_length = 32};
+        // Accepted frames are exactly at the limit, rejected ones one byte over
+        const std::vector<std::pair<std::string, bool>> cases = {
+            {"*2\r\n$10\r\n0123456789\r\n+abcdefgh\r\n", true},
+            {"*2\r\n$10\r\n0123456789\r\n+abcdefghi\r\n", false},
+            // Bulk payloads are checked at their header
+            {"*1\r\n$21\r\n", true},
+            {"*1\r\n$22\r\n", false},
+            // Non-bulk elements declare no length but still count
+            {"*8\r\n:1\r\n:2\r\n:3\r\n:4\r\n:5\r\n:6\r\n:7\r\n", true},
+            {"*9\r\n:1\r\n:2\r\n:3\r\n:4\r\n:5\r\n:6\r\n:7\r\n:8\r\n", false},
+            // A partial line is rejected before its CRLF arrives
+            {"*1\r\n+" + std::string(27, 'a'), true},
+            {"*1\r\n+" + std::string(28, 'a'), false},
+        };
+
+        for (const auto& [input, accepted] : cases) {
+            protocol::IncrementalParser parser(limits);
+            auto result = parser.parse(input);
+            if (accepted) {
+                EXPECT_TRUE(result.has_value() || result.error() == protocol::ParseError::Incomplete) << input;
+            } else {
+                ASSERT_FALSE(result.has_value()) << input;
+                EXPECT_EQ(result.error(), protocol::ParseError::LimitExceeded) << input;
+                EXPECT_FALSE(parser.in_progress());
+            }
+        }
+    }
+
+    TEST(IncrementalParserTest, FrameLengthExcludesPipelinedInput) {
+        protocol::IncrementalParser parser({.max_frame_length = 16});
+        std::string const frame = "*1\r\n$4\r\nPING\r\n";
+        ASSERT_TRUE(parser.parse(frame + frame + frame).has_value());
+        EXPECT_EQ(parser.frame_size(), frame.size());
+    }
+
+    TEST(IncrementalParserTest, ReportsPendingBulk) {
+        protocol::IncrementalParser parser;
+        EXPECT_EQ(parser.pending_bulk_length(), 0);
+        EXPECT_FALSE(parser.parse("*2\r\n$3\r\nSET\r\n$100\r\nabc").has_value());
+        EXPECT_EQ(parser.pending_bulk_length(), 100);
+        EXPECT_EQ(parser.pending_bulk_end(), 19 + 100 + 2);
+        parser.reset();
+        EXPECT_EQ(parser.pending_bulk_end(), 0);
+    }
+
+}
@@ -289,4 +289,20 @@ namespace gmredis::test {
         EXPECT_EQ(input, "");
     }
 
-}
\ No newline at end of file
+    TEST(ParseTest, NullBulkString) {
+        std::string_view input = "$-1\r\n+OK\r\n";
+        auto result = protocol::parse(input);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_TRUE(std::holds_alternative<protocol::Null>(result.value()));
+        EXPECT_EQ(input, "+OK\r\n");
+    }
+
+    TEST(ParseTest, ArrayDeclaredLengthDoesNotReserveUpFront) {
+        // Reserving two billion elements would throw or exhaust memory
+        std::string_view input = "*2147483647\r\n:1\r\n";
+        auto result = protocol::parse_view(input);
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), protocol::ParseError::Incomplete);
+    }
+
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/protocol/reply_sink.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        std::shared_ptr<const std::string> shared(std::string value) {
+            return std::make_shared<const std::string>(std::move(value));
+        }
+
+        std::vector<std::string> chunks_of(const protocol::ReplyBuffer& buffer) {
+            std::vector<std::string> chunks;
+            buffer.for_each_chunk([&chunks](std::string_view chunk) { chunks.emplace_back(chunk); });
+            return chunks;
+        }
+    }
+
+    TEST(ReplyBufferTest, SplicesReferencesBetweenBytes) {
+        protocol::ReplyBuffer buffer;
+        buffer.bytes() += "$5\r\n";
+        buffer.append_reference(shared("hello"));
+        buffer.bytes() += "\r\n";
+        buffer.append_reference(shared("a"));
+        buffer.append_reference(shared("b"));
+
+        EXPECT_EQ(chunks_of(buffer), (std::vector<std::string>{"$5\r\n", "hello", "\r\n", "a", "b"}));
+        EXPECT_EQ(buffer.size(), 13);
+        EXPECT_EQ(buffer.str(), "$5\r\nhello\r\nab");
+    }
+
+    TEST(ReplyBufferTest, KeepsValuesAliveUntilCleared) {
+        protocol::ReplyBuffer buffer;
+        auto value = shared("payload");
+        std::weak_ptr<const std::string> const watch = value;
+        buffer.append_reference(std::move(value));
+
+        EXPECT_FALSE(watch.expired());
+        buffer.clear();
+        EXPECT_TRUE(watch.expired());
+        EXPECT_TRUE(buffer.empty());
+    }
+
+    TEST(ReplySinkTest, ReferencesSharedBulkStringsInAReplyBuffer) {
+        auto const value = shared(std::string(4096, 'x'));
+
+        protocol::ReplyBuffer buffer;
+        protocol::ReplySink sink(buffer);
+        sink.begin_array(2);
+        sink.bulk(value);
+        sink.bulk("small");
+        EXPECT_TRUE(buffer.has_references());
+        EXPECT_EQ(buffer.bytes(), "*2\r\n$4096\r\n\r\n$5\r\nsmall\r\n");
+
+        // A plain string gets the same bytes, copied
+        std::string flat;
+        protocol::ReplySink copying(flat);
+        copying.begin_array(2);
+        copying.bulk(value);
+        copying.bulk("small");
+        EXPECT_EQ(buffer.str(), flat);
+    }
+
+    TEST(ReplySinkTest, RewindDropsReferencedValues) {
+        protocol::ReplyBuffer buffer;
+        protocol::ReplySink sink(buffer);
+        sink.bulk(shared("kept"));
+        auto const mark = sink.mark();
+        sink.begin_array(1);
+        sink.bulk(shared("dropped"));
+
+        sink.rewind(mark);
+        EXPECT_EQ(buffer.str(), "$4\r\nkept\r\n");
+        EXPECT_EQ(buffer.size(), 10);
+    }
+
+}
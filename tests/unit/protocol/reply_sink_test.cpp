@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/reply_sink.h"
+#include "gmredis/protocol/serialize.h"
+#include "gmredis/protocol/shared_replies.h"
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace gmredis::test {
+
+    TEST(ReplySinkTest, EncodesScalars) {
+        std::string output;
+        protocol::ReplySink sink(output);
+        sink.simple_string("OK");
+        sink.error("ERR boom");
+        sink.bulk("hello");
+        sink.bulk("");
+        sink.null();
+        EXPECT_EQ(output, "+OK\r\n-ERR boom\r\n$5\r\nhello\r\n$0\r\n\r\n$-1\r\n");
+    }
+
+    TEST(ReplySinkTest, EncodesIntegersLikeSerialize) {
+        for (std::int64_t const value : {std::int64_t{0}, std::int64_t{42}, std::int64_t{10000}, std::int64_t{-1},
+                                         std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()}) {
+            std::string output;
+            protocol::ReplySink sink(output);
+            sink.integer(value);
+            EXPECT_EQ(output, protocol::serialize(protocol::Integer{value}));
+        }
+    }
+
+    TEST(ReplySinkTest, StreamsArraysLikeTheMaterializedValue) {
+        protocol::Array const expected{.values = {
+            protocol::BulkString{.value = "key", .length = 3},
+            protocol::Array{.values = {protocol::Integer{1}, protocol::Null{}}},
+            protocol::SimpleString{"OK"},
+        }};
+
+        std::string output = "prefix";
+        protocol::ReplySink sink(output);
+        sink.begin_array(3);
+        sink.bulk("key");
+        sink.begin_array(2);
+        sink.integer(1);
+        sink.null();
+        sink.write(protocol::shared::ok);
+        EXPECT_EQ(output, "prefix" + protocol::serialize(expected));
+    }
+
+    TEST(ReplySinkTest, RewindDropsAPartialReply) {
+        std::string output = "+PONG\r\n";
+        protocol::ReplySink sink(output);
+        auto const mark = sink.mark();
+        sink.begin_array(2);
+        sink.bulk("half");
+        sink.rewind(mark);
+        sink.write(protocol::RespValue{protocol::SimpleError{"ERR failed"}});
+        EXPECT_EQ(output, "+PONG\r\n-ERR failed\r\n");
+    }
+
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/parse.h"
+#include "gmredis/protocol/resp_view.h"
+#include "support/allocation_counter.h"
+#include <string>
+
+namespace gmredis::test {
+
+    namespace {
+        std::string set_request(std::size_t value_size) {
+            std::string value(value_size, 'v');
+            return "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+        }
+
+        bool points_into(std::string_view view, const std::string& buffer) {
+            return view.data() >= buffer.data() && view.data() + view.size() <= buffer.data() + buffer.size();
+        }
+    }
+
+    TEST(RespViewTest, BulkStringViewsInputBuffer) {
+        std::string const buffer = "$5\r\nhello\r\n";
+        std::string_view input = buffer;
+
+        auto result = protocol::parse_view(input);
+        ASSERT_TRUE(result.has_value());
+        auto* bulk = std::get_if<protocol::BulkStringView>(&result.value());
+        ASSERT_NE(bulk, nullptr);
+        EXPECT_EQ(bulk->value, "hello");
+        EXPECT_EQ(bulk->value.data(), buffer.data() + 4);
+        EXPECT_TRUE(input.empty());
+    }
+
+    TEST(RespViewTest, ArrayElementsViewInputBuffer) {
+        std::string const buffer = set_request(10 * 1024);
+        std::string_view input = buffer;
+
+        auto result = protocol::parse_view(input);
+        ASSERT_TRUE(result.has_value());
+        auto& array = std::get<protocol::ArrayView>(result.value());
+        ASSERT_EQ(array.values.size(), 3);
+        for (const auto& element : array.values) {
+            EXPECT_TRUE(points_into(std::get<protocol::BulkStringView>(element).value, buffer));
+        }
+        EXPECT_EQ(std::get<protocol::BulkStringView>(array.values[2]).value.size(), 10 * 1024);
+    }
+
+    TEST(RespViewTest, ParsingCostDoesNotDependOnPayloadSize) {
+        std::string const small = set_request(8);
+        std::string const large = set_request(10 * 1024);
+
+        auto count = [](const std::string& buffer) {
+            std::string_view input = buffer;
+            auto before = allocation_count();
+            auto result = protocol::parse_view(input);
+            auto allocations = allocation_count() - before;
+            EXPECT_TRUE(result.has_value());
+            return allocations;
+        };
+
+        EXPECT_EQ(count(small), count(large));
+    }
+
+    TEST(RespViewTest, IncompleteInputIsNotConsumed) {
+        std::string const buffer = "*2\r\n$3\r\nGET\r\n$3\r\nke";
+        std::string_view input = buffer;
+
+        auto result = protocol::parse_view(input);
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error(), protocol::ParseError::Incomplete);
+    }
+
+    TEST(RespViewTest, UnknownPrefixIsUnsupported) {
+        for (std::string const buffer : {"?foo\r\n", "\xff" "foo\r\n"}) {
+            std::string_view input = buffer;
+            auto result = protocol::parse_view(input);
+            ASSERT_FALSE(result.has_value());
+            EXPECT_EQ(result.error(), protocol::ParseError::Unsupported);
+        }
+    }
+
+    TEST(RespViewTest, OwningParseMatchesViewParse) {
+        std::string const buffer = "*5\r\n+OK\r\n-ERR bad\r\n:42\r\n$-1\r\n*1\r\n$3\r\nfoo\r\n";
+        std::string_view view_input = buffer;
+        std::string_view owned_input = buffer;
+
+        auto view = protocol::parse_view(view_input);
+        auto owned = protocol::parse(owned_input);
+        ASSERT_TRUE(view.has_value());
+        ASSERT_TRUE(owned.has_value());
+        EXPECT_EQ(protocol::to_owned(*view), *owned);
+        EXPECT_EQ(view_input.size(), owned_input.size());
+    }
+
+    TEST(RespViewTest, ToViewRoundTrips) {
+        protocol::Array const array{.values = {
+            protocol::BulkString{.value = "SET", .length = 3},
+            protocol::SimpleString{.value = "OK"},
+            protocol::Integer{7},
+            protocol::Null{},
+            protocol::Array{.values = {protocol::SimpleError{.value = "ERR"}}},
+        }};
+
+        auto view = protocol::to_view(array);
+        EXPECT_EQ(std::get<protocol::BulkStringView>(view.values[0]).value.data(),
+                  std::get<protocol::BulkString>(array.values[0]).value.data());
+        EXPECT_EQ(protocol::to_owned(view), array);
+    }
+
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "protocol/scan.h"
+#include <random>
+#include <string>
+
+namespace gmredis::test {
+
+    namespace {
+        std::size_t reference_find(std::string_view input, std::size_t from) {
+            return input.find("\r\n", from);
+        }
+    }
+
+    TEST(ScanTest, ScalarScannerIsAlwaysAvailable) {
+        auto scanners = protocol::crlf_scanners();
+        ASSERT_FALSE(scanners.empty());
+        EXPECT_EQ(scanners.front().name, "scalar");
+    }
+
+    TEST(ScanTest, ScannersFindCrlfAtEveryPosition) {
+        for (const auto& scanner : protocol::crlf_scanners()) {
+            for (std::size_t size = 2; size < 100; size++) {
+                for (std::size_t at = 0; at + 1 < size; at++) {
+                    std::string input(size, 'x');
+                    input[at] = '\r';
+                    input[at + 1] = '\n';
+                    EXPECT_EQ(scanner.find(input, 0), at) << scanner.name << " size " << size;
+                }
+            }
+        }
+    }
+
+    TEST(ScanTest, ScannersIgnoreLoneCrAndLf) {
+        std::string const input = std::string(40, 'a') + "\r" + std::string(20, 'b') + "\n\n\r" + std::string(31, 'c') + "\r";
+        for (const auto& scanner : protocol::crlf_scanners()) {
+            EXPECT_EQ(scanner.find(input, 0), std::string_view::npos) << scanner.name;
+            EXPECT_EQ(scanner.find("", 0), std::string_view::npos) << scanner.name;
+            EXPECT_EQ(scanner.find("\r", 0), std::string_view::npos) << scanner.name;
+        }
+    }
+
+    TEST(ScanTest, ScannersMatchStringFindOnRandomInput) {
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> byte(0, 3);
+        const char alphabet[] = {'\r', '\n', 'a', '$'};
+
+        for (int run = 0; run < 200; run++) {
+            std::string input(static_cast<std::size_t>(run) + 1, ' ');
+            for (auto& c : input) {
+                c = alphabet[byte(rng)];
+            }
+            for (std::size_t from = 0; from <= input.size(); from += 7) {
+                for (const auto& scanner : protocol::crlf_scanners()) {
+                    EXPECT_EQ(scanner.find(input, from), reference_find(input, from)) << scanner.name;
+                }
+                EXPECT_EQ(protocol::find_crlf(input, from), reference_find(input, from));
+            }
+        }
+    }
+
+    TEST(ScanTest, ParseDecimalAcceptsDigits) {
+        std::size_t value = 0;
+        for (std::string_view text : {"0", "7", "42", "1234", "99999999", "100000000", "9999999999999999999", "18446744073709551615"}) {
+            ASSERT_TRUE(protocol::parse_decimal(text, value)) << text;
+            EXPECT_EQ(std::to_string(value), text);
+        }
+        ASSERT_TRUE(protocol::parse_decimal("00012", value));
+        EXPECT_EQ(value, 12);
+    }
+
+    TEST(ScanTest, ParseDecimalRejectsNonDigits) {
+        std::size_t value = 0;
+        for (std::string_view text : {"", "-1", "+1", "12a", "a12", "1 2", "1\r", ":", "/", "18446744073709551616"}) {
+            EXPECT_FALSE(protocol::parse_decimal(text, value)) << text;
+        }
+    }
+
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "gmredis/protocol/serialize.h"
 #include "gmredis/protocol/resp_v3.h"
+#include "support/allocation_counter.h"
+#include <cstdint>
+#include <limits>
+#include <string>
 
 namespace gmredis::test {
     TEST(SerializeTest, SimpleStringSerialization) {
@@ -106,4 +110,54 @@ namespace gmredis::test {
         auto serialized = protocol::serialize(arr);
         EXPECT_EQ(serialized, "*1\r\n:123\r\n");
     }
+
+    TEST(SerializeTest, NullSerialization) {
+        protocol::RespValue const null_value = protocol::Null{};
+        auto serialized = protocol::serialize(null_value);
+        EXPECT_EQ(serialized, "$-1\r\n");
+    }
+
+    TEST(SerializeTest, IntegerLimits) {
+        EXPECT_EQ(protocol::serialize(protocol::Integer{0}), ":0\r\n");
+        EXPECT_EQ(protocol::serialize(protocol::Integer{std::numeric_limits<std::int64_t>::max()}),
+                  ":9223372036854775807\r\n");
+        EXPECT_EQ(protocol::serialize(protocol::Integer{std::numeric_limits<std::int64_t>::min()}),
+                  ":-9223372036854775808\r\n");
+    }
+
+    TEST(SerializeTest, SerializeToAppendsToOutput) {
+        std::string output = "+OK\r\n";
+        protocol::serialize_to(output, protocol::Integer{42});
+        protocol::serialize_to(output, protocol::RespValue{protocol::Null{}});
+        EXPECT_EQ(output, "+OK\r\n:42\r\n$-1\r\n");
+    }
+
+    TEST(SerializeTest, SerializedSizeIsExact) {
+        protocol::Array nested{.values = {protocol::Integer{-7}, protocol::SimpleError{"ERR x"}}};
+        protocol::Array outer{.values = {protocol::BulkString{.value = "0123456789", .length = 10},
+                                         protocol::SimpleString{"OK"}, nested, protocol::Null{}}};
+        protocol::RespValue const value = outer;
+        EXPECT_EQ(protocol::serialized_size(value), protocol::serialize(value).size());
+    }
+
+    TEST(SerializeTest, SerializeToLargeArrayAllocatesAtMostOnce) {
+        protocol::Array array;
+        for (int i = 0; i < 1000; i++) {
+            auto value = std::to_string(i);
+            array.values.emplace_back(protocol::BulkString{.value = value, .length = value.size()});
+        }
+        protocol::RespValue const value = std::move(array);
+
+        std::string output;
+        auto const before = allocation_count();
+        protocol::serialize_to(output, value);
+        EXPECT_LE(allocation_count() - before, 1);
+
+        // A buffer that already has the capacity is not reallocated
+        output.clear();
+        auto const reused = allocation_count();
+        protocol::serialize_to(output, value);
+        EXPECT_EQ(allocation_count() - reused, 0);
+        EXPECT_EQ(output, protocol::serialize(value));
+    }
 }
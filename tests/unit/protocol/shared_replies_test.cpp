@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/shared_replies.h"
+#include "gmredis/protocol/resp_view.h"
+#include "gmredis/protocol/serialize.h"
+#include "support/allocation_counter.h"
+#include <string>
+
+namespace gmredis::test {
+
+    TEST(SharedRepliesTest, IntegersMatchTheSerializer) {
+        for (std::int64_t value = 0; value < protocol::shared::integer_count; value++) {
+            ASSERT_EQ(protocol::shared::integer(value).bytes, ":" + std::to_string(value) + "\r\n");
+        }
+    }
+
+    TEST(SharedRepliesTest, IntegerReplyFallsBackOutsideTheTable) {
+        EXPECT_EQ(protocol::shared::integer_reply(7), protocol::RespValue{protocol::shared::integer(7)});
+        EXPECT_EQ(protocol::shared::integer_reply(-1), protocol::RespValue{protocol::Integer{-1}});
+        EXPECT_EQ(protocol::shared::integer_reply(protocol::shared::integer_count),
+                  protocol::RespValue{protocol::Integer{protocol::shared::integer_count}});
+    }
+
+    TEST(SharedRepliesTest, SerializeCopiesTheBytes) {
+        std::string output;
+        protocol::serialize_to(output, protocol::RespValue{protocol::shared::ok});
+        protocol::serialize_to(output, protocol::Array{.values = {protocol::shared::pong, protocol::shared::null_bulk}});
+        EXPECT_EQ(output, "+OK\r\n*2\r\n+PONG\r\n$-1\r\n");
+        EXPECT_EQ(protocol::serialized_size(protocol::shared::protocol_error),
+                  protocol::shared::protocol_error.bytes.size());
+    }
+
+    TEST(SharedRepliesTest, SerializeDoesNotAllocateIntoReservedBuffer) {
+        std::string output;
+        output.reserve(64);
+        auto const before = allocation_count();
+        protocol::serialize_to(output, protocol::RespValue{protocol::shared::pong});
+        protocol::serialize_to(output, protocol::shared::integer_reply(42));
+        EXPECT_EQ(allocation_count() - before, 0);
+        EXPECT_EQ(output, "+PONG\r\n:42\r\n");
+    }
+
+    TEST(SharedRepliesTest, ViewDecodesTheReply) {
+        EXPECT_EQ(protocol::to_view(protocol::shared::pong), protocol::RespValueView{protocol::SimpleStringView{"PONG"}});
+        EXPECT_EQ(protocol::to_view(protocol::shared::integer(12)), protocol::RespValueView{protocol::Integer{12}});
+        EXPECT_EQ(protocol::to_view(protocol::shared::null_bulk), protocol::RespValueView{protocol::Null{}});
+    }
+
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "gmredis/protocol/incremental_parser.h"
+#include "gmredis/protocol/parse.h"
+#include "gmredis/protocol/tape.h"
+#include "support/allocation_counter.h"
+#include <string>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        std::vector<protocol::RespValueView> collect(const protocol::ArrayRef& array) {
+            std::vector<protocol::RespValueView> values;
+            for (const auto& value : array) {
+                values.push_back(value);
+            }
+            return values;
+        }
+    }
+
+    TEST(TapeTest, RequestIsFlat) {
+        protocol::IncrementalParser parser;
+        std::string_view frame = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n";
+        ASSERT_TRUE(parser.parse_tape(frame).has_value());
+
+        const auto& tape = parser.tape();
+        ASSERT_EQ(tape.elements.size(), 4);
+        ASSERT_TRUE(tape.is_array());
+        EXPECT_EQ(tape.elements[0].length, 3);
+        EXPECT_EQ(tape.elements[0].end, 4);
+
+        auto args = tape.array();
+        ASSERT_EQ(args.size(), 3);
+        EXPECT_EQ(args[0], protocol::RespValueView{protocol::BulkStringView{"SET"}});
+        EXPECT_EQ(args[2], protocol::RespValueView{protocol::BulkStringView{"value"}});
+        EXPECT_EQ(parser.frame_size(), frame.size());
+    }
+
+    TEST(TapeTest, ArrayRefSkipsNestedArrays) {
+        protocol::IncrementalParser parser;
+        std::string_view frame = "*4\r\n:1\r\n*2\r\n*1\r\n:2\r\n:3\r\n$-1\r\n+end\r\n";
+        ASSERT_TRUE(parser.parse_tape(frame).has_value());
+
+        const auto& tape = parser.tape();
+        EXPECT_EQ(tape.elements[0].end, tape.elements.size());
+        EXPECT_EQ(tape.next(2), 6);
+
+        auto array = tape.array();
+        ASSERT_EQ(array.size(), 4);
+        EXPECT_EQ(array[0], protocol::RespValueView{protocol::Integer{1}});
+        EXPECT_EQ(array[2], protocol::RespValueView{protocol::Null{}});
+        EXPECT_EQ(array[3], protocol::RespValueView{protocol::SimpleStringView{"end"}});
+
+        std::string_view input = frame;
+        auto expected = protocol::parse_view(input);
+        ASSERT_TRUE(expected.has_value());
+        EXPECT_EQ(tape.value(), *expected);
+        EXPECT_EQ(array.to_view(), std::get<protocol::ArrayView>(*expected));
+        EXPECT_EQ(collect(array), std::get<protocol::ArrayView>(*expected).values);
+    }
+
+    TEST(TapeTest, ArrayRefOverArrayView) {
+        protocol::ArrayView view{.values = {protocol::BulkStringView{"GET"}, protocol::BulkStringView{"k"}}};
+        protocol::ArrayRef array = view;
+        ASSERT_EQ(array.size(), 2);
+        EXPECT_EQ(array[1], protocol::RespValueView{protocol::BulkStringView{"k"}});
+        EXPECT_EQ(collect(array), view.values);
+    }
+
+    TEST(TapeTest, SteadyStateParsingDoesNotAllocate) {
+        protocol::IncrementalParser parser;
+        std::string_view frame = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$5\r\nvalue\r\n";
+        ASSERT_TRUE(parser.parse_tape(frame).has_value());
+
+        auto const before = allocation_count();
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(parser.parse_tape(frame).has_value());
+            auto key = std::get<protocol::BulkStringView>(parser.tape().array()[1]).value;
+            ASSERT_EQ(key, "key");
+        }
+        EXPECT_EQ(allocation_count() - before, 0);
+    }
+
+    TEST(TapeTest, DeepNestingDoesNotRecurse) {
+        constexpr std::size_t depth = 100000;
+        std::string frame;
+        for (std::size_t i = 0; i < depth; i++) {
+            frame += "*1\r\n";
+        }
+        frame += ":1\r\n";
+
+        protocol::IncrementalParser parser({.max_nesting_depth = depth});
+        ASSERT_TRUE(parser.parse_tape(frame).has_value());
+        const auto& tape = parser.tape();
+        ASSERT_EQ(tape.elements.size(), depth + 1);
+        EXPECT_EQ(tape.elements[depth - 1].end, depth + 1);
+        EXPECT_EQ(tape.array(depth - 1)[0], protocol::RespValueView{protocol::Integer{1}});
+    }
+
+}
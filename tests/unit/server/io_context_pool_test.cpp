@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "gmredis/server/io_context_pool.h"
+#include "gmredis/server/server_config.h"
+#include <latch>
+#include <mutex>
+#include <set>
+
+namespace gmredis::test {
+
+    TEST(IoContextPoolTest, ZeroSizeCreatesOneContext) {
+        server::IoContextPool pool(0);
+        EXPECT_EQ(pool.size(), 1);
+    }
+
+    TEST(IoContextPoolTest, EachContextRunsOnItsOwnThread) {
+        constexpr std::size_t pool_size = 4;
+        server::IoContextPool pool(pool_size);
+
+        std::mutex mutex;
+        std::set<std::thread::id> thread_ids;
+        std::latch done(pool_size);
+        for (std::size_t i = 0; i < pool_size; i++) {
+            asio::post(pool.get_io_context(i), [&] {
+                {
+                    std::lock_guard const lock(mutex);
+                    thread_ids.insert(std::this_thread::get_id());
+                }
+                done.count_down();
+            });
+        }
+
+        pool.run();
+        done.wait();
+        pool.stop();
+        pool.join();
+
+        EXPECT_EQ(thread_ids.size(), pool_size);
+        EXPECT_FALSE(thread_ids.contains(std::this_thread::get_id()));
+    }
+
+    TEST(IoContextPoolTest, NextIoContextIsRoundRobin) {
+        server::IoContextPool pool(3);
+        auto* first = &pool.next_io_context();
+        auto* second = &pool.next_io_context();
+        auto* third = &pool.next_io_context();
+
+        EXPECT_NE(first, second);
+        EXPECT_NE(second, third);
+        EXPECT_EQ(first, &pool.next_io_context());
+    }
+
+    TEST(IoContextPoolTest, PinnedThreadsStillRun) {
+        server::IoContextPool pool(2, true);
+        std::latch done(2);
+        for (std::size_t i = 0; i < pool.size(); i++) {
+            asio::post(pool.get_io_context(i), [&] { done.count_down(); });
+        }
+
+        pool.run();
+        done.wait();
+        pool.stop();
+        pool.join();
+        SUCCEED();
+    }
+
+    TEST(ServerConfigTest, ZeroIoThreadsUsesHardwareConcurrency) {
+        server::ServerConfig config;
+        config.io_threads = 0;
+        EXPECT_GE(server::effective_io_threads(config), 1);
+
+        config.io_threads = 3;
+        EXPECT_EQ(server::effective_io_threads(config), 3);
+    }
+}
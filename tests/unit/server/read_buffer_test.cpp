@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "gmredis/server/read_buffer.h"
+#include <cstring>
+#include <string>
+
+namespace gmredis::test {
+
+    namespace {
+        void append(server::ReadBuffer& buffer, std::string_view bytes) {
+            auto tail = buffer.prepare(bytes.size());
+            ASSERT_GE(tail.size(), bytes.size());
+            std::memcpy(tail.data(), bytes.data(), bytes.size());
+            buffer.commit(bytes.size());
+        }
+    }
+
+    TEST(ReadBufferTest, StartsEmpty) {
+        server::ReadBuffer buffer;
+        EXPECT_TRUE(buffer.empty());
+        EXPECT_EQ(buffer.capacity(), server::ReadBuffer::default_capacity);
+    }
+
+    TEST(ReadBufferTest, CommitMakesBytesReadable) {
+        server::ReadBuffer buffer(64);
+        append(buffer, "*1\r\n$4\r\n");
+        append(buffer, "PING\r\n");
+        EXPECT_EQ(buffer.data(), "*1\r\n$4\r\nPING\r\n");
+    }
+
+    TEST(ReadBufferTest, ConsumeDropsFromFront) {
+        server::ReadBuffer buffer(64);
+        append(buffer, "+OK\r\n+PONG\r\n");
+        buffer.consume(5);
+        EXPECT_EQ(buffer.data(), "+PONG\r\n");
+    }
+
+    TEST(ReadBufferTest, FullConsumeRewindsToStart) {
+        server::ReadBuffer buffer(16);
+        append(buffer, "0123456789");
+        buffer.consume(10);
+        EXPECT_TRUE(buffer.empty());
+        EXPECT_EQ(buffer.prepare(16).size(), 16);
+    }
+
+    TEST(ReadBufferTest, PrepareCompactsInsteadOfGrowing) {
+        server::ReadBuffer buffer(16);
+        append(buffer, "0123456789ab");
+        buffer.consume(10);
+
+        auto tail = buffer.prepare(8);
+        EXPECT_EQ(buffer.capacity(), 16);
+        EXPECT_EQ(tail.size(), 14);
+        EXPECT_EQ(buffer.data(), "ab");
+    }
+
+    TEST(ReadBufferTest, PrepareGrowsForLargeFrames) {
+        server::ReadBuffer buffer(16);
+        std::string const large(10000, 'x');
+        append(buffer, "$10000\r\n");
+        append(buffer, large);
+        append(buffer, "\r\n");
+
+        EXPECT_GE(buffer.capacity(), 10010);
+        EXPECT_EQ(buffer.data(), "$10000\r\n" + large + "\r\n");
+    }
+
+    TEST(ReadBufferTest, PrepareDoesNotMoveDataWhenTailIsLargeEnough) {
+        server::ReadBuffer buffer(64);
+        append(buffer, "abc");
+        auto const* before = buffer.data().data();
+        buffer.prepare(16);
+        EXPECT_EQ(buffer.data().data(), before);
+    }
+
+    TEST(ReadBufferTest, ReserveAllocatesExactly) {
+        server::ReadBuffer buffer(64);
+        append(buffer, "$1000\r\n");
+        buffer.reserve(1008);
+        EXPECT_EQ(buffer.capacity(), 1008);
+        EXPECT_EQ(buffer.data(), "$1000\r\n");
+
+        // The rest of the frame fits without growing again
+        append(buffer, std::string(1000, 'v'));
+        EXPECT_EQ(buffer.capacity(), 1008);
+    }
+
+    TEST(ReadBufferTest, ReserveCompactsWhenLargeEnough) {
+        server::ReadBuffer buffer(64);
+        append(buffer, std::string(40, 'x'));
+        buffer.consume(30);
+        buffer.reserve(60);
+        EXPECT_EQ(buffer.capacity(), 64);
+        EXPECT_EQ(buffer.data(), std::string(10, 'x'));
+        append(buffer, std::string(50, 'y'));
+        EXPECT_EQ(buffer.capacity(), 64);
+    }
+
+    TEST(ReadBufferTest, ShrinkKeepsReadableBytes) {
+        server::ReadBuffer buffer(4096);
+        append(buffer, "+OK\r\n");
+        buffer.shrink(16);
+        EXPECT_EQ(buffer.capacity(), 16);
+        EXPECT_EQ(buffer.data(), "+OK\r\n");
+
+        buffer.shrink(2);
+        EXPECT_EQ(buffer.capacity(), 5);
+        EXPECT_EQ(buffer.data(), "+OK\r\n");
+    }
+
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "server/request_processor.h"
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/protocol/reply_buffer.h"
+#include "gmredis/storage/kv.h"
+#include <cstring>
+#include <string>
+
+namespace gmredis::test {
+
+    namespace {
+        server::RequestProcessor make_processor(const server::ServerConfig& config) {
+            auto dispatcher = std::make_shared<command::CommandDispatcher>(
+                command::make_command_selector(storage::make_store()));
+            return server::RequestProcessor(dispatcher, config);
+        }
+
+        void append(server::ReadBuffer& buffer, std::string_view bytes) {
+            auto tail = buffer.prepare(bytes.size());
+            std::memcpy(tail.data(), bytes.data(), bytes.size());
+            buffer.commit(bytes.size());
+        }
+    }
+
+    TEST(RequestProcessorTest, AnswersPipelinedRequests) {
+        auto processor = make_processor(server::ServerConfig{});
+        server::ReadBuffer input;
+        protocol::ReplyBuffer output;
+        append(input, "*1\r\n$4\r\nPING\r\n*3\r\n$3\r\nSET\r\n$1\r\nk\r\n$1\r\nv\r\n*2\r\n$3\r\nGET\r\n$1\r\nk\r\n*1\r\n$4\r\nPI");
+
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::NeedInput);
+        EXPECT_EQ(output.str(), "+PONG\r\n+OK\r\n$1\r\nv\r\n");
+        EXPECT_EQ(input.data(), "*1\r\n$4\r\nPI");
+    }
+
+    TEST(RequestProcessorTest, ClosesOnLimitExceeded) {
+        server::ServerConfig config;
+        config.limits.max_multibulk_length = 8;
+        auto processor = make_processor(config);
+        server::ReadBuffer input;
+        protocol::ReplyBuffer output;
+        append(input, "*2147483647\r\n");
+
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::Close);
+        EXPECT_EQ(output.str(), "-ERR Protocol error: request exceeds protocol limits\r\n");
+    }
+
+    TEST(RequestProcessorTest, SizesBufferForLargeBulk) {
+        server::ServerConfig config;
+        config.large_bulk_threshold = 1024;
+        auto processor = make_processor(config);
+        server::ReadBuffer input(64);
+        protocol::ReplyBuffer output;
+
+        std::string const header = "*3\r\n$3\r\nSET\r\n$1\r\nk\r\n$100000\r\n";
+        append(input, header);
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::NeedInput);
+        auto const frame_size = header.size() + 100000 + 2;
+        EXPECT_EQ(input.capacity(), frame_size);
+        EXPECT_EQ(processor.missing_input(input), 100002);
+
+        // The payload arrives without the buffer growing again
+        append(input, std::string(100000, 'v'));
+        append(input, "\r\n");
+        EXPECT_EQ(input.capacity(), frame_size);
+        EXPECT_EQ(processor.missing_input(input), 0);
+
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::NeedInput);
+        EXPECT_EQ(output.str(), "+OK\r\n");
+        EXPECT_EQ(input.capacity(), server::ReadBuffer::default_capacity);
+    }
+
+    TEST(RequestProcessorTest, CountsTraffic) {
+        auto stats = std::make_shared<command::Stats>();
+        auto dispatcher = std::make_shared<command::CommandDispatcher>(
+            command::make_command_selector(storage::make_store(), stats), stats);
+        server::RequestProcessor processor(dispatcher, server::ServerConfig{});
+        server::ReadBuffer input;
+        protocol::ReplyBuffer output;
+        output.bytes() = "pending";
+        append(input, "*1\r\n$4\r\nPING\r\n*1\r\n$4\r\nPI");
+
+        processor.record_connection();
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::NeedInput);
+
+        // Only complete frames count as input, and only new replies as output
+        auto const snapshot = stats->snapshot();
+        EXPECT_EQ(snapshot.connections_received, 1);
+        EXPECT_EQ(snapshot.net_input_bytes, 14);
+        EXPECT_EQ(snapshot.net_output_bytes, 7);
+        EXPECT_EQ(snapshot.commands[static_cast<std::size_t>(command::CommandType::Ping)].calls, 1);
+    }
+
+    TEST(RequestProcessorTest, RecordsRequestLatencyOnceWritten) {
+        auto stats = std::make_shared<command::Stats>();
+        auto dispatcher = std::make_shared<command::CommandDispatcher>(
+            command::make_command_selector(storage::make_store(), stats), stats);
+        server::RequestProcessor processor(dispatcher, server::ServerConfig{});
+        server::ReadBuffer input;
+        protocol::ReplyBuffer output;
+
+        append(input, "*1\r\n$4\r\nPING\r\n*1\r\n$4\r\nPING\r\n");
+        processor.process(input, output);
+        append(input, "*1\r\n$4\r\nPING\r\n");
+        processor.process(input, output);
+        EXPECT_EQ(stats->latency_snapshot().requests.total(), 0);
+
+        // Replies of both batches are written together
+        auto const replies = processor.take_pending();
+        EXPECT_EQ(replies.count, 3);
+        processor.record_written(replies);
+        EXPECT_EQ(stats->latency_snapshot().requests.total(), 3);
+        EXPECT_EQ(processor.take_pending().count, 0);
+    }
+
+    TEST(RequestProcessorTest, LargeValuesAreReferencedUntilCleared) {
+        auto processor = make_processor(server::ServerConfig{});
+        server::ReadBuffer input;
+        protocol::ReplyBuffer output;
+        std::string const value(4096, 'a');
+        auto const set = [&](std::string_view payload) {
+            append(input, "*3\r\n$3\r\nSET\r\n$1\r\nk\r\n$" + std::to_string(payload.size()) + "\r\n");
+            append(input, payload);
+            append(input, "\r\n");
+        };
+
+        set(value);
+        append(input, "*2\r\n$3\r\nGET\r\n$1\r\nk\r\n");
+        EXPECT_EQ(processor.process(input, output), server::BatchStatus::NeedInput);
+        EXPECT_TRUE(output.has_references());
+        EXPECT_EQ(output.bytes().size(), 5 + 7 + 2);
+
+        // Overwriting the key while the reply is unwritten leaves the reply intact
+        protocol::ReplyBuffer next;
+        set(std::string(4096, 'b'));
+        EXPECT_EQ(processor.process(input, next), server::BatchStatus::NeedInput);
+        EXPECT_EQ(output.str(), "+OK\r\n$4096\r\n" + value + "\r\n");
+        EXPECT_EQ(output.size(), output.str().size());
+
+        output.clear();
+        EXPECT_TRUE(output.empty());
+        EXPECT_FALSE(output.has_references());
+    }
+
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "server/session.h"
+#include "support/allocation_counter.h"
+#include "gmredis/command/dispatcher.h"
+#include "gmredis/storage/kv.h"
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace gmredis::test {
+
+    namespace {
+        constexpr std::string_view ping_request = "*1\r\n$4\r\nPING\r\n";
+        constexpr std::string_view pong_reply = "+PONG\r\n";
+        constexpr std::size_t warmup_round_trips = 64;
+        constexpr std::size_t measured_round_trips = 1000;
+
+        server::RequestProcessor make_processor() {
+            auto dispatcher = std::make_shared<command::CommandDispatcher>(
+                command::make_command_selector(storage::make_store()));
+            return server::RequestProcessor(dispatcher, server::ServerConfig{});
+        }
+
+        // Allocations made by parsing, executing and serializing one request on its own,
+        // i.e. the share of a round trip that is not the session's doing.
+        std::size_t processor_allocations(server::RequestProcessor& processor, std::size_t requests) {
+            server::ReadBuffer input;
+            protocol::ReplyBuffer output;
+            auto process = [&] {
+                auto tail = input.prepare(ping_request.size());
+                std::memcpy(tail.data(), ping_request.data(), ping_request.size());
+                input.commit(ping_request.size());
+                processor.process(input, output);
+                output.clear();
+            };
+
+            for (std::size_t i = 0; i < warmup_round_trips; i++) {
+                process();
+            }
+
+            auto before = allocation_count();
+            for (std::size_t i = 0; i < requests; i++) {
+                process();
+            }
+            return allocation_count() - before;
+        }
+    }
+
+    TEST(HandlerMemoryTest, ReusesBlockOnceReleased) {
+        server::HandlerMemory memory;
+        auto* first = memory.allocate(128);
+        memory.deallocate(first);
+        auto* second = memory.allocate(256);
+        EXPECT_EQ(first, second);
+        memory.deallocate(second);
+    }
+
+    TEST(HandlerMemoryTest, FallsBackToHeapWhenBusyOrTooLarge) {
+        server::HandlerMemory memory;
+        auto* block = memory.allocate(64);
+        auto* busy = memory.allocate(64);
+        EXPECT_NE(block, busy);
+        memory.deallocate(busy);
+        memory.deallocate(block);
+
+        auto before = allocation_count();
+        auto* large = memory.allocate(server::HandlerMemory::block_size + 1);
+        EXPECT_EQ(allocation_count() - before, 1);
+        memory.deallocate(large);
+    }
+
+    TEST(SessionTest, SteadyStateIoDoesNotAllocate) {
+        auto processor = make_processor();
+        auto expected = processor_allocations(processor, measured_round_trips);
+
+        asio::io_context server_context(1);
+        asio::ip::tcp::acceptor acceptor(server_context, {asio::ip::make_address("127.0.0.1"), 0});
+
+        asio::io_context client_context;
+        asio::ip::tcp::socket client(client_context);
+        client.connect(acceptor.local_endpoint());
+        server::Session::start(acceptor.accept(), make_processor());
+
+        std::jthread server_thread([&server_context] { server_context.run(); });
+
+        std::string reply(pong_reply.size(), '\0');
+        auto round_trip = [&] {
+            asio::write(client, asio::buffer(ping_request));
+            asio::read(client, asio::buffer(reply));
+        };
+
+        for (std::size_t i = 0; i < warmup_round_trips; i++) {
+            round_trip();
+        }
+
+        auto before = allocation_count();
+        for (std::size_t i = 0; i < measured_round_trips; i++) {
+            round_trip();
+        }
+        auto measured = allocation_count() - before;
+
+        EXPECT_EQ(reply, pong_reply);
+        EXPECT_EQ(measured, expected) << "session I/O allocated " << measured - expected << " times over "
+                                      << measured_round_trips << " requests";
+
+        client.close();
+        server_context.stop();
+    }
+
+}
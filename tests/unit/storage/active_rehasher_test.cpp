@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include "gmredis/storage/active_rehasher.h"
+#include "storage/kv_mem.h"
+#include "storage/kv_sharded.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace gmredis::test {
+
+    namespace {
+        /** Puts keys into every shard until at least one of them is mid-rehash. */
+        void start_a_rehash(storage::KVStore& store) {
+            for (int i = 0; !store.rehash_for(std::chrono::microseconds::zero()); i++) {
+                ASSERT_TRUE(store.put("key" + std::to_string(i), "value").has_value());
+            }
+        }
+    }
+
+    TEST(ShardedKVStoreTest, RehashForDrivesEveryShard) {
+        storage::ShardedKVStore store(4, [] { return std::make_unique<storage::KVMemoryStore>(); });
+        start_a_rehash(store);
+        EXPECT_FALSE(store.rehash_for(std::chrono::seconds(10)));
+    }
+
+    TEST(ActiveRehasherTest, FinishesRehashWithoutWrites) {
+        auto store = std::make_shared<storage::ShardedKVStore>(
+            4, [] { return std::make_unique<storage::KVMemoryStore>(); });
+        start_a_rehash(*store);
+
+        storage::ActiveRehasher const rehasher(store, std::chrono::milliseconds(1), std::chrono::microseconds(1000));
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (store->rehash_for(std::chrono::microseconds::zero()) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_FALSE(store->rehash_for(std::chrono::microseconds::zero()));
+    }
+
+}
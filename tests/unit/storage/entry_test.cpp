@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "storage/entry.h"
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace gmredis::test {
+
+    TEST(EntryTest, SmallValueIsEmbedded) {
+        storage::Entry const entry("key", "value");
+        EXPECT_EQ(entry.key(), "key");
+        EXPECT_EQ(entry.value(), "value");
+
+        auto const view = entry.read();
+        EXPECT_EQ(view.bytes, "value");
+        EXPECT_EQ(view.shared, nullptr);
+    }
+
+    TEST(EntryTest, EmptyKeyAndValue) {
+        storage::Entry const entry("", "");
+        EXPECT_EQ(entry.key(), "");
+        EXPECT_EQ(entry.value(), "");
+    }
+
+    TEST(EntryTest, MultiByteLengthHeaders) {
+        // 200 and 2000 bytes need two varint bytes each
+        std::string const key(200, 'k');
+        std::string const value(2000, 'v');
+        storage::Entry const entry(key, value);
+        EXPECT_EQ(entry.key(), key);
+        EXPECT_EQ(entry.value(), value);
+        EXPECT_EQ(entry.read().shared, nullptr);
+    }
+
+    TEST(EntryTest, LargeValueIsShared) {
+        std::string const value(storage::Entry::shared_threshold, 'v');
+        storage::Entry const entry("key", value);
+        EXPECT_EQ(entry.key(), "key");
+        EXPECT_EQ(entry.value(), value);
+
+        auto const view = entry.read();
+        ASSERT_NE(view.shared, nullptr);
+        EXPECT_EQ(view.bytes.data(), (*view.shared)->data());
+        EXPECT_EQ(**view.shared, value);
+    }
+
+    TEST(EntryTest, LargeValueIsMovedIn) {
+        std::string value(storage::Entry::shared_threshold, 'v');
+        const auto* data = value.data();
+        storage::Entry const entry("key", std::move(value));
+        EXPECT_EQ(entry.value().data(), data);
+    }
+
+    TEST(EntryTest, AssignKeepsKeyAcrossLayouts) {
+        storage::Entry entry("some-key", "one");
+        entry.assign("two");
+        EXPECT_EQ(entry.value(), "two");
+
+        entry.assign("a longer value");
+        EXPECT_EQ(entry.value(), "a longer value");
+
+        std::string const large(storage::Entry::shared_threshold, 'l');
+        entry.assign(large);
+        EXPECT_EQ(entry.value(), large);
+        ASSERT_NE(entry.read().shared, nullptr);
+        auto const kept = *entry.read().shared;
+
+        entry.assign("small");
+        EXPECT_EQ(entry.key(), "some-key");
+        EXPECT_EQ(entry.value(), "small");
+        EXPECT_EQ(entry.read().shared, nullptr);
+        // A reader holding the old large value still has it
+        EXPECT_EQ(*kept, large);
+    }
+
+    TEST(EntryTest, MoveTransfersTheBlock) {
+        storage::Entry first("key", std::string(storage::Entry::shared_threshold, 'v'));
+        auto const* data = first.value().data();
+
+        storage::Entry second(std::move(first));
+        EXPECT_EQ(second.value().data(), data);
+
+        storage::Entry third("other", "value");
+        third = std::move(second);
+        EXPECT_EQ(third.key(), "key");
+        EXPECT_EQ(third.value().data(), data);
+    }
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "storage/flat_table.h"
+#include "storage/kv_flat.h"
+#include <memory>
+#include <string>
+
+namespace gmredis::test {
+
+    TEST(FlatTableTest, EmptyTableFindsNothing) {
+        storage::FlatTable table;
+        EXPECT_EQ(table.find("key"), nullptr);
+        EXPECT_FALSE(table.erase("key"));
+        EXPECT_EQ(table.size(), 0);
+        EXPECT_EQ(table.capacity(), 0);
+    }
+
+    TEST(FlatTableTest, InsertFindAndOverwrite) {
+        storage::FlatTable table;
+        table.insert_or_assign("key", "one");
+        ASSERT_NE(table.find("key"), nullptr);
+        EXPECT_EQ(table.find("key")->value(), "one");
+
+        table.insert_or_assign("key", "two");
+        EXPECT_EQ(table.find("key")->value(), "two");
+        EXPECT_EQ(table.size(), 1);
+        EXPECT_EQ(table.capacity(), storage::FlatTable::group_width);
+    }
+
+    TEST(FlatTableTest, EmptyKeyAndValue) {
+        storage::FlatTable table;
+        table.insert_or_assign("", "");
+        ASSERT_NE(table.find(""), nullptr);
+        EXPECT_EQ(table.find("")->value(), "");
+        EXPECT_TRUE(table.erase(""));
+        EXPECT_EQ(table.find(""), nullptr);
+    }
+
+    TEST(FlatTableTest, GrowsAndKeepsEveryKey) {
+        storage::FlatTable table;
+        for (int i = 0; i < 10000; i++) {
+            table.insert_or_assign("key:" + std::to_string(i), std::to_string(i));
+        }
+        EXPECT_EQ(table.size(), 10000);
+        // At most 7/8 full, and a power of two
+        EXPECT_GE(table.capacity() - table.capacity() / 8, table.size());
+        EXPECT_EQ(table.capacity() & (table.capacity() - 1), 0);
+
+        for (int i = 0; i < 10000; i++) {
+            const auto* entry = table.find("key:" + std::to_string(i));
+            ASSERT_NE(entry, nullptr) << i;
+            EXPECT_EQ(entry->value(), std::to_string(i));
+        }
+        EXPECT_EQ(table.find("key:10000"), nullptr);
+    }
+
+    TEST(FlatTableTest, EraseLeavesOtherKeys) {
+        storage::FlatTable table;
+        for (int i = 0; i < 1000; i++) {
+            table.insert_or_assign(std::to_string(i), "v");
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            EXPECT_TRUE(table.erase(std::to_string(i)));
+        }
+        EXPECT_FALSE(table.erase("0"));
+        EXPECT_EQ(table.size(), 500);
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_EQ(table.find(std::to_string(i)) != nullptr, i % 2 == 1) << i;
+        }
+    }
+
+    TEST(FlatTableTest, ChurnDoesNotGrowTheTable) {
+        // Erasing and inserting different keys leaves tombstones; once the live keys fill at most
+        // half the usable slots they are reclaimed by rehashing in place rather than growing
+        storage::FlatTable table;
+        for (int i = 0; i < 100; i++) {
+            table.insert_or_assign(std::to_string(i), "v");
+        }
+        auto const capacity = table.capacity();
+        for (int i = 100; i < 100000; i++) {
+            EXPECT_TRUE(table.erase(std::to_string(i - 100)));
+            table.insert_or_assign(std::to_string(i), "v");
+        }
+        EXPECT_EQ(table.size(), 100);
+        EXPECT_LE(table.capacity(), capacity * 2);
+        for (int i = 99900; i < 100000; i++) {
+            EXPECT_NE(table.find(std::to_string(i)), nullptr) << i;
+        }
+    }
+
+    TEST(KVFlatStoreTest, PutGetDel) {
+        storage::KVFlatStore store;
+        EXPECT_TRUE(store.put("key", "value").has_value());
+
+        auto result = store.get("key");
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), "value");
+
+        EXPECT_EQ(store.del("key").value(), 1);
+        EXPECT_EQ(store.del("key").value(), 0);
+
+        auto missing = store.get("key");
+        ASSERT_FALSE(missing.has_value());
+        EXPECT_EQ(missing.error().code, storage::KVError::KeyNotFound);
+    }
+
+    TEST(KVStoreFactoryTest, MakesEachBackend) {
+        for (auto backend : {storage::StoreBackend::Unordered, storage::StoreBackend::Flat}) {
+            auto store = storage::make_store(backend);
+            EXPECT_TRUE(store->put("key", "value").has_value()) << storage::to_string(backend);
+            EXPECT_EQ(store->get("key").value(), "value") << storage::to_string(backend);
+        }
+        EXPECT_EQ(storage::to_string(storage::StoreBackend::Flat), "flat");
+    }
+
+    TEST(FlatTableTest, MovesLargeOwnedValuesIntoEntries) {
+        storage::FlatTable table;
+        std::string value(storage::Entry::shared_threshold, 'v');
+        const auto* const value_data = value.data();
+
+        table.insert_or_assign(std::string(40, 'k'), std::move(value));
+        const auto* stored = table.find(std::string(40, 'k'));
+        ASSERT_NE(stored, nullptr);
+        EXPECT_EQ(stored->value().data(), value_data);
+
+        // An existing entry keeps its key and takes the new value
+        std::string replacement(storage::Entry::shared_threshold * 2, 'w');
+        const auto* const replacement_data = replacement.data();
+        table.insert_or_assign(std::string(40, 'k'), std::move(replacement));
+        EXPECT_EQ(table.find(std::string(40, 'k'))->value().data(), replacement_data);
+        EXPECT_EQ(table.size(), 1);
+    }
+
+    TEST(KVStoreFactoryTest, EveryBackendSharesLargeValues) {
+        std::string const large(storage::Entry::shared_threshold, 'l');
+        for (auto backend : {storage::StoreBackend::Unordered, storage::StoreBackend::Flat}) {
+            auto store = storage::make_store(backend);
+            ASSERT_TRUE(store->put("small", "value").has_value());
+            ASSERT_TRUE(store->put("large", large).has_value());
+
+            EXPECT_TRUE(store->read("small", [](const storage::ValueView& value) {
+                EXPECT_EQ(value.bytes, "value");
+                EXPECT_EQ(value.shared, nullptr);
+            }).has_value()) << storage::to_string(backend);
+
+            std::shared_ptr<const std::string> kept;
+            EXPECT_TRUE(store->read("large", [&](const storage::ValueView& value) {
+                ASSERT_NE(value.shared, nullptr);
+                EXPECT_EQ(value.bytes.data(), (*value.shared)->data());
+                kept = *value.shared;
+            }).has_value()) << storage::to_string(backend);
+
+            // Overwriting leaves the buffer a reader kept alone
+            ASSERT_TRUE(store->put("large", std::string(storage::Entry::shared_threshold, 'm')).has_value());
+            ASSERT_NE(kept, nullptr) << storage::to_string(backend);
+            EXPECT_EQ(*kept, large) << storage::to_string(backend);
+        }
+    }
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include "storage/kv_mem.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
 
 namespace gmredis::test {
     TEST(KVMemoryStoreTest, DefaultConstructor) {
@@ -48,4 +52,112 @@ namespace gmredis::test {
         EXPECT_TRUE(getResult.has_value());
         EXPECT_EQ(getResult.value(), "value2");
     }
+
+    TEST(KVMemoryStoreTest, DeleteReportsWhetherKeyExisted) {
+        storage::KVMemoryStore store;
+        EXPECT_TRUE(store.put("key1", "value1").has_value());
+        EXPECT_EQ(store.del("key1").value(), 1);
+        EXPECT_EQ(store.del("key1").value(), 0);
+        EXPECT_FALSE(store.get("key1").has_value());
+    }
+
+    TEST(KVMemoryStoreTest, KeysStayVisibleDuringIncrementalRehash) {
+        storage::KVMemoryStore store;
+        bool rehashed = false;
+        for (int i = 0; i < 5000; i++) {
+            EXPECT_TRUE(store.put("key" + std::to_string(i), std::to_string(i)).has_value());
+            if (!store.rehashing()) {
+                continue;
+            }
+            rehashed = true;
+            // Keys still in the old table and keys already moved are both found
+            for (int j = 0; j <= i; j += 97) {
+                auto result = store.get("key" + std::to_string(j));
+                ASSERT_TRUE(result.has_value()) << j;
+                EXPECT_EQ(result.value(), std::to_string(j));
+            }
+        }
+        EXPECT_TRUE(rehashed);
+        EXPECT_EQ(store.size(), 5000);
+    }
+
+    TEST(KVMemoryStoreTest, OverwriteAndDeleteDuringIncrementalRehash) {
+        storage::KVMemoryStore store;
+        int i = 0;
+        while (!store.rehashing()) {
+            EXPECT_TRUE(store.put("key" + std::to_string(i++), "old").has_value());
+        }
+        auto const keys = i;
+
+        EXPECT_TRUE(store.put("key0", "new").has_value());
+        EXPECT_EQ(store.del("key1").value(), 1);
+        EXPECT_EQ(store.del("key1").value(), 0);
+        EXPECT_EQ(store.get("key0").value(), "new");
+        EXPECT_FALSE(store.get("key1").has_value());
+        EXPECT_EQ(store.size(), static_cast<std::size_t>(keys - 1));
+    }
+
+    TEST(KVMemoryStoreTest, RehashForFinishesTheRehash) {
+        storage::KVMemoryStore store;
+        int i = 0;
+        while (!store.rehashing()) {
+            EXPECT_TRUE(store.put("key" + std::to_string(i++), "value").has_value());
+        }
+        EXPECT_FALSE(store.rehash_for(std::chrono::seconds(10)));
+        EXPECT_FALSE(store.rehashing());
+        for (int j = 0; j < i; j++) {
+            EXPECT_TRUE(store.get("key" + std::to_string(j)).has_value()) << j;
+        }
+    }
+
+    TEST(KVMemoryStoreTest, KeysAreViewsIntoLargerBuffers) {
+        storage::KVMemoryStore store;
+        std::string_view const request = "SETkey1value1GETkey1";
+        EXPECT_TRUE(store.put(request.substr(3, 4), request.substr(7, 6)).has_value());
+
+        auto getResult = store.get(request.substr(16, 4));
+        ASSERT_TRUE(getResult.has_value());
+        EXPECT_EQ(getResult.value(), "value1");
+        EXPECT_FALSE(store.get(request.substr(16, 3)).has_value());
+    }
+
+    TEST(KVMemoryStoreTest, PutOwnedStoresAndOverwrites) {
+        storage::KVMemoryStore store;
+        EXPECT_TRUE(store.put_owned(std::string("key1"), std::string(64, 'a')).has_value());
+        EXPECT_EQ(store.get("key1").value(), std::string(64, 'a'));
+
+        EXPECT_TRUE(store.put_owned(std::string("key1"), std::string("value2")).has_value());
+        EXPECT_EQ(store.get("key1").value(), "value2");
+        EXPECT_EQ(store.size(), 1);
+    }
+
+    TEST(KVMemoryStoreTest, ReadSharesLargeValuesOnly) {
+        storage::KVMemoryStore store;
+        EXPECT_TRUE(store.put("small", "value").has_value());
+        EXPECT_TRUE(store.put("large", std::string(storage::Entry::shared_threshold, 'a')).has_value());
+
+        std::string bytes;
+        bool shared = true;
+        EXPECT_TRUE(store.read("small", [&](const storage::ValueView& value) {
+            bytes = value.bytes;
+            shared = value.shared != nullptr;
+        }).has_value());
+        EXPECT_EQ(bytes, "value");
+        EXPECT_FALSE(shared);
+
+        std::shared_ptr<const std::string> kept;
+        EXPECT_TRUE(store.read("large", [&](const storage::ValueView& value) {
+            ASSERT_NE(value.shared, nullptr);
+            kept = *value.shared;
+        }).has_value());
+
+        // The buffer a reader kept is not touched by later writes
+        EXPECT_TRUE(store.put("large", std::string(storage::Entry::shared_threshold, 'b')).has_value());
+        EXPECT_TRUE(store.del("large").has_value());
+        EXPECT_EQ(*kept, std::string(storage::Entry::shared_threshold, 'a'));
+
+        auto missing = store.read("large", [](const storage::ValueView&) { FAIL(); });
+        ASSERT_FALSE(missing.has_value());
+        EXPECT_EQ(missing.error().code, storage::KVError::KeyNotFound);
+    }
 }
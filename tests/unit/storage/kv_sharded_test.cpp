@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "storage/kv_mem.h"
+#include "storage/kv_sharded.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace gmredis::test {
+
+    namespace {
+        std::unique_ptr<storage::ShardedKVStore> make_sharded(std::size_t shards) {
+            return std::make_unique<storage::ShardedKVStore>(shards, [] { return std::make_unique<storage::KVMemoryStore>(); });
+        }
+    }
+
+    TEST(ShardedKVStoreTest, RoundsShardCountToPowerOfTwo) {
+        EXPECT_EQ(make_sharded(0)->shard_count(), 1);
+        EXPECT_EQ(make_sharded(5)->shard_count(), 8);
+        EXPECT_EQ(make_sharded(64)->shard_count(), 64);
+    }
+
+    TEST(ShardedKVStoreTest, PutAndGetAcrossShards) {
+        auto store = make_sharded(8);
+        std::vector<bool> used(store->shard_count());
+        for (int i = 0; i < 100; i++) {
+            auto const key = "key" + std::to_string(i);
+            EXPECT_TRUE(store->put(key, std::to_string(i)).has_value());
+            used[store->shard_of(key)] = true;
+        }
+        for (int i = 0; i < 100; i++) {
+            auto result = store->get("key" + std::to_string(i));
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value(), std::to_string(i));
+        }
+        EXPECT_EQ(std::count(used.begin(), used.end(), true), 8);
+
+        auto missing = store->get("nope");
+        ASSERT_FALSE(missing.has_value());
+        EXPECT_EQ(missing.error().code, storage::KVError::KeyNotFound);
+    }
+
+    TEST(ShardedKVStoreTest, KeyLocksReachTheShardStores) {
+        auto store = make_sharded(4);
+        // Views into one buffer, as a command's arguments are
+        std::string_view const request = "abca";
+        std::vector<std::string_view> const keys{request.substr(0, 1), request.substr(1, 1), request.substr(2, 1), request.substr(3, 1)};
+        {
+            auto locks = store->lock(keys, storage::ShardedKVStore::LockMode::Exclusive);
+            for (auto const key : keys) {
+                EXPECT_TRUE(locks.store(key).put(key, std::string(key) + "!").has_value());
+            }
+        }
+        EXPECT_EQ(store->get("b").value(), "b!");
+
+        auto locks = store->lock(keys, storage::ShardedKVStore::LockMode::Shared);
+        EXPECT_EQ(locks.store("c").get("c").value(), "c!");
+        // Readers of the same shards are not blocked
+        EXPECT_EQ(store->get("a").value(), "a!");
+    }
+
+    TEST(ShardedKVStoreTest, MultiKeyLocksDoNotDeadlock) {
+        auto store = make_sharded(16);
+        std::vector<std::string> names;
+        for (int i = 0; i < 16; i++) {
+            names.push_back("key" + std::to_string(i));
+        }
+        std::vector<std::string_view> const keys(names.begin(), names.end());
+        std::vector<std::string_view> const reversed(keys.rbegin(), keys.rend());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&, t] {
+                const auto& order = t % 2 == 0 ? keys : reversed;
+                for (int i = 0; i < 500; i++) {
+                    auto locks = store->lock(order, storage::ShardedKVStore::LockMode::Exclusive);
+                    for (auto const key : order) {
+                        [[maybe_unused]] auto _ = locks.store(key).put(key, std::to_string(i));
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (const auto& key : keys) {
+            EXPECT_EQ(store->get(key).value(), "499");
+        }
+    }
+
+    TEST(ShardedKVStoreTest, ConcurrentReadWrite) {
+        auto store = make_sharded(4);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; t++) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 1000; i++) {
+                    auto const key = "key" + std::to_string(t) + ":" + std::to_string(i % 50);
+                    EXPECT_TRUE(store->put(key, std::to_string(i)).has_value());
+                    EXPECT_TRUE(store->get(key).has_value());
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(store->get("key7:49").value(), "999");
+    }
+
+    TEST(ShardedKVStoreTest, PutOwnedReachesTheShardStore) {
+        auto store = make_sharded(8);
+        std::string key = "owned";
+        EXPECT_TRUE(store->put_owned(std::move(key), std::string(64, 'v')).has_value());
+
+        auto result = store->get("owned");
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), std::string(64, 'v'));
+    }
+}
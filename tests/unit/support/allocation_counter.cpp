@@ -0,0 +1,83 @@
+#include "allocation_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<std::size_t> allocations{0};
+
+    void* counted_allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* counted_allocate(std::size_t size, std::align_val_t alignment) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        auto align = static_cast<std::size_t>(alignment);
+        // aligned_alloc requires the size to be a multiple of the alignment
+        auto rounded = (size + align - 1) / align * align;
+        if (void* pointer = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+}
+
+namespace gmredis::test {
+
+    std::size_t allocation_count() noexcept {
+        return allocations.load(std::memory_order_relaxed);
+    }
+
+}
+
+void* operator new(std::size_t size) {
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return counted_allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return counted_allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return counted_allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    std::free(pointer);
+}
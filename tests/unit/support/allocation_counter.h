@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace gmredis::test {
+
+    /**
+     * @brief Number of global operator new calls made so far by any thread.
+     *
+     * The unit test binary replaces the global allocation functions to keep this count; take
+     * the difference of two readings around the code under test.
+     */
+    std::size_t allocation_count() noexcept;
+
+}
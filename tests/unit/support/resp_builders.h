@@ -0,0 +1,15 @@
+#pragma once
+
+#include "gmredis/protocol/resp_view.h"
+#include <string_view>
+
+namespace gmredis::test {
+
+    /**
+     * @brief A bulk string argument viewing value, for building command arguments in tests.
+     */
+    inline protocol::BulkStringView bulk(std::string_view value) {
+        return protocol::BulkStringView{.value = value};
+    }
+
+}